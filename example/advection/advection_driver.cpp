@@ -52,10 +52,25 @@ AdvectionDriver::AdvectionDriver(ParameterInput *pin, ApplicationInput *app_in,
   pin->CheckDesired("Advection", "derefine_tol");
 }
 
+// Shallow copies of md holding the first and the remaining advected variables
+std::vector<std::shared_ptr<MeshData<Real>>>
+FluxCorrectionSubsets(Mesh *pmesh, std::shared_ptr<MeshData<Real>> &md) {
+  const int num_vars = pmesh->packages.Get("advection_package")->Param<int>("num_vars");
+  std::vector<std::string> rest;
+  for (int var = 1; var < num_vars; ++var)
+    rest.push_back("advected_" + std::to_string(var));
+  const std::string label = md->StageName() + "_flxcor";
+  const std::vector<std::string> first{"advected"};
+  return {pmesh->mesh_data.AddShallow(label + "0", md, first),
+          pmesh->mesh_data.AddShallow(label + "1", md, rest)};
+}
+
 // See the advection.hpp declaration for a description of how this function gets called.
 TaskCollection AdvectionDriver::MakeTaskCollection(BlockList_t &blocks, const int stage) {
   using namespace parthenon::Update;
   TaskCollection tc;
+  const bool split_flux_correction =
+      pmesh->packages.Get("advection_package")->Param<bool>("split_flux_correction");
   TaskID none(0);
 
   const Real beta = integrator->beta[stage - 1];
@@ -81,7 +96,8 @@ TaskCollection AdvectionDriver::MakeTaskCollection(BlockList_t &blocks, const in
     const auto any = parthenon::BoundaryType::any;
 
     tl.AddTask(none, parthenon::StartReceiveBoundBufs<any>, mc1);
-    tl.AddTask(none, parthenon::StartReceiveFluxCorrections, mc0);
+    tl.AddTask(none, parthenon::StartReceiveFluxCorrections,
+               split_flux_correction ? FluxCorrectionSubsets(pmesh, mc0).front() : mc0);
   }
 
   // Number of task lists that can be executed independently and thus *may*
@@ -118,7 +134,15 @@ TaskCollection AdvectionDriver::MakeTaskCollection(BlockList_t &blocks, const in
     auto &mc1 = pmesh->mesh_data.Add(stage_name[stage], mbase);
     auto &mdudt = pmesh->mesh_data.Add("dUdt", mbase);
 
-    auto set_flx = parthenon::AddFluxCorrectionTasks(none, tl, mc0, pmesh->multilevel);
+    TaskID set_flx = none;
+    if (split_flux_correction) {
+      // The subsets share the combined flux correction buffers, so they are corrected
+      // one after the other
+      for (auto &md : FluxCorrectionSubsets(pmesh, mc0))
+        set_flx = parthenon::AddFluxCorrectionTasks(set_flx, tl, md, pmesh->multilevel);
+    } else {
+      set_flx = parthenon::AddFluxCorrectionTasks(none, tl, mc0, pmesh->multilevel);
+    }
 
     // compute the divergence of fluxes of conserved variables
     auto flux_div =
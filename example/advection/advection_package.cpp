@@ -147,6 +147,14 @@ std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin) {
   pkg->AddParam<>("vec_size", vec_size);
   pkg->AddParam<>("num_vars", num_vars);
 
+  // Correct the fluxes of the first and of the remaining advected variables through
+  // separate MeshData, which exercises flux correction of subsets of the variables
+  const auto split_flux_correction =
+      pin->GetOrAddBoolean("Advection", "split_flux_correction", false);
+  PARTHENON_REQUIRE_THROWS(!split_flux_correction || num_vars > 1,
+                           "Splitting flux corrections requires num_vars > 1.");
+  pkg->AddParam<>("split_flux_correction", split_flux_correction);
+
   // Give a custom labels to advected in the data output
   std::string field_name_base = "advected";
   std::string field_name;
@@ -12,6 +12,9 @@
 //========================================================================================
 
 // Standard Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -23,6 +26,8 @@
 #include <coordinates/coordinates.hpp>
 #include <kokkos_abstraction.hpp>
 #include <mesh/domain.hpp>
+#include <mesh/forest/forest.hpp>
+#include <mesh/forest/forest_node.hpp>
 #include <parthenon/package.hpp>
 
 // Local Includes
@@ -98,9 +103,278 @@ TaskStatus SetBlockValues(MeshData<Real> *md) {
           pack(b, neighbor_info(7), k, j, i) = k;
         });
   }
+
+  if (pmesh->packages.Get("boundary_exchange")->Param<bool>("cubed_sphere")) {
+    IndexRange ib = md->GetBoundsI(IndexDomain::interior);
+    IndexRange jb = md->GetBoundsJ(IndexDomain::interior);
+    IndexRange kb = md->GetBoundsK(IndexDomain::interior);
+    for (int b = 0; b < md->NumBlocks(); ++b) {
+      auto pmb = md->GetBlockData(b)->GetBlockPointer();
+      auto &data = md->GetBlockData(b)->Get(position::name()).data;
+      auto data_h = data.GetHostMirror();
+      const int ncells = pmb->block_size.nx(X1DIR) << pmb->loc.level();
+      const std::array<int, 3> lx{static_cast<int>(pmb->loc.lx1()),
+                                  static_cast<int>(pmb->loc.lx2()),
+                                  static_cast<int>(pmb->loc.lx3())};
+      for (int k = 0; k < data_h.GetDim(3); ++k) {
+        for (int j = 0; j < data_h.GetDim(2); ++j) {
+          for (int i = 0; i < data_h.GetDim(1); ++i) {
+            const std::array<int, 3> idx{i - ib.s, j - jb.s, k - kb.s};
+            const bool interior = (i >= ib.s) && (i <= ib.e) && (j >= jb.s) &&
+                                  (j <= jb.e) && (k >= kb.s) && (k <= kb.e);
+            std::array<Real, 3> x;
+            for (int d = 0; d < 3; ++d)
+              x[d] = (lx[d] * pmb->block_size.nx(X1DIR) + idx[d] + 0.5) / ncells;
+            const auto pos = CubedSpherePosition(pmb->loc.tree(), x);
+            for (int d = 0; d < 3; ++d)
+              data_h(d, k, j, i) =
+                  interior ? pos[d] : std::numeric_limits<Real>::quiet_NaN();
+          }
+        }
+      }
+      data.DeepCopy(data_h);
+    }
+  }
+
+  if (pmesh->packages.Get("boundary_exchange")->Param<int>("ghost_depth") > 0) {
+    auto desc_depth = parthenon::MakePackDescriptor<full_depth, reduced_depth>(md);
+    auto pack_depth = desc_depth.GetPack(md);
+    IndexRange ib = md->GetBoundsI(IndexDomain::interior);
+    IndexRange jb = md->GetBoundsJ(IndexDomain::interior);
+    IndexRange kb = md->GetBoundsK(IndexDomain::interior);
+    IndexRange ibe = md->GetBoundsI(IndexDomain::entire);
+    IndexRange jbe = md->GetBoundsJ(IndexDomain::entire);
+    IndexRange kbe = md->GetBoundsK(IndexDomain::entire);
+    parthenon::par_for(
+        parthenon::loop_pattern_mdrange_tag, "SetGhostDepthValues", DevExecSpace(), 0,
+        pack_depth.GetNBlocks() - 1, kbe.s, kbe.e, jbe.s, jbe.e, ibe.s, ibe.e,
+        KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
+          const bool interior = (i >= ib.s) && (i <= ib.e) && (j >= jb.s) &&
+                                (j <= jb.e) && (k >= kb.s) && (k <= kb.e);
+          const Real val = interior ? gid(b) + 0.1 * i + 0.01 * j + 0.001 * k
+                                    : std::numeric_limits<Real>::quiet_NaN();
+          pack_depth(b, full_depth(), k, j, i) = val;
+          pack_depth(b, reduced_depth(), k, j, i) = val;
+        });
+  }
   return TaskStatus::complete;
 }
 
+int CheckGhostDepth(MeshData<Real> *md) {
+  auto pmesh = md->GetMeshPointer();
+  const int ghost_depth =
+      pmesh->packages.Get("boundary_exchange")->Param<int>("ghost_depth");
+  // Communicated depth, which is rounded up to an even number on multilevel meshes
+  const int depth = std::min(
+      parthenon::Globals::nghost,
+      pmesh->multilevel ? ghost_depth + ghost_depth % 2 : ghost_depth);
+
+  auto desc = parthenon::MakePackDescriptor<full_depth, reduced_depth>(md);
+  auto pack = desc.GetPack(md);
+
+  // Ghost zones beyond physical boundaries are set by boundary conditions, which fill
+  // all ghost zones
+  parthenon::ParArray2D<int> communicated("communicated faces", pack.GetNBlocks(),
+                                          parthenon::BOUNDARY_NFACES);
+  auto communicated_h = Kokkos::create_mirror_view(communicated);
+  for (int b = 0; b < md->NumBlocks(); ++b) {
+    auto pmb = md->GetBlockData(b)->GetBlockPointer();
+    for (int f = 0; f < parthenon::BOUNDARY_NFACES; ++f) {
+      communicated_h(b, f) = (pmb->boundary_flag[f] == parthenon::BoundaryFlag::block) ||
+                             (pmb->boundary_flag[f] == parthenon::BoundaryFlag::periodic);
+    }
+  }
+  Kokkos::deep_copy(communicated, communicated_h);
+
+  IndexRange ib = md->GetBoundsI(IndexDomain::interior);
+  IndexRange jb = md->GetBoundsJ(IndexDomain::interior);
+  IndexRange kb = md->GetBoundsK(IndexDomain::interior);
+  IndexRange ibe = md->GetBoundsI(IndexDomain::entire);
+  IndexRange jbe = md->GetBoundsJ(IndexDomain::entire);
+  IndexRange kbe = md->GetBoundsK(IndexDomain::entire);
+  int nwrong = 0;
+  parthenon::par_reduce(
+      parthenon::loop_pattern_mdrange_tag, "CheckGhostDepth", DevExecSpace(), 0,
+      pack.GetNBlocks() - 1, kbe.s, kbe.e, jbe.s, jbe.e, ibe.s, ibe.e,
+      KOKKOS_LAMBDA(const int b, const int k, const int j, const int i, int &lwrong) {
+        const int di = (i < ib.s) ? ib.s - i : ((i > ib.e) ? i - ib.e : 0);
+        const int dj = (j < jb.s) ? jb.s - j : ((j > jb.e) ? j - jb.e : 0);
+        const int dk = (k < kb.s) ? kb.s - k : ((k > kb.e) ? k - kb.e : 0);
+        const int d = std::max(di, std::max(dj, dk));
+        if (d == 0) return;
+        const Real full = pack(b, full_depth(), k, j, i);
+        const Real reduced = pack(b, reduced_depth(), k, j, i);
+        // The default depth fills every ghost zone
+        if (std::isnan(full)) lwrong += 1;
+        if (d <= depth) {
+          if (reduced != full) lwrong += 1;
+        } else {
+          const bool physical = (di > 0 && !communicated(b, (i < ib.s) ? 0 : 1)) ||
+                                (dj > 0 && !communicated(b, (j < jb.s) ? 2 : 3)) ||
+                                (dk > 0 && !communicated(b, (k < kb.s) ? 4 : 5));
+          if (!physical && !std::isnan(reduced)) lwrong += 1;
+        }
+      },
+      Kokkos::Sum<int>(nwrong));
+  return nwrong;
+}
+
+namespace {
+// Index of node b of a tree of the cubed sphere shell. Tree 2 * dir + side lies above
+// the face of the inner cube on the given side of direction dir. Bit d of the index is
+// set for nodes on the upper side of direction d, and nodes of the outer cube are offset
+// by eight.
+int CubedSphereNode(int tree, int b) {
+  const int dir = tree / 2;
+  const int side = tree % 2;
+  const int corner = (side << dir) | ((b & 1) << ((dir + 1) % 3)) |
+                     (((b >> 1) & 1) << ((dir + 2) % 3));
+  return corner + ((b & 4) ? 8 : 0);
+}
+
+std::array<Real, 3> NodePosition(int node) {
+  const Real r = (node < 8) ? 1.0 : 2.0;
+  return {(node & 1) ? r : -r, (node & 2) ? r : -r, (node & 4) ? r : -r};
+}
+} // namespace
+
+parthenon::forest::ForestDefinition MakeCubedSphereForest() {
+  using parthenon::forest::Node;
+  std::array<std::shared_ptr<Node>, 16> n;
+  for (int c = 0; c < 16; ++c)
+    n[c] = Node::create(c, NodePosition(c));
+
+  // The x3 direction of every tree points outward and its x1 and x2 directions are the
+  // other two global directions in cyclic order
+  parthenon::forest::ForestDefinition forest_def;
+  for (int tree = 0; tree < 6; ++tree) {
+    std::array<std::shared_ptr<Node>, 8> nodes;
+    for (int b = 0; b < 8; ++b)
+      nodes[b] = n[CubedSphereNode(tree, b)];
+    forest_def.AddCell(tree, nodes);
+    forest_def.AddBC({nodes[0], nodes[1], nodes[2], nodes[3]},
+                     parthenon::BoundaryFlag::outflow);
+    forest_def.AddBC({nodes[4], nodes[5], nodes[6], nodes[7]},
+                     parthenon::BoundaryFlag::outflow);
+  }
+  // The refined block touches the neighbors of the first tree in x1 and x2, which are
+  // refined once to keep the mesh properly nested
+  forest_def.AddInitialRefinement(parthenon::LogicalLocation(0, 2, 0, 0, 0));
+  return forest_def;
+}
+
+std::array<Real, 3> CubedSpherePosition(int tree, const std::array<Real, 3> &x) {
+  // Trilinear interpolation between the nodes of the tree
+  std::array<Real, 3> pos{0.0, 0.0, 0.0};
+  for (int b = 0; b < 8; ++b) {
+    Real w = 1.0;
+    for (int d = 0; d < 3; ++d)
+      w *= ((b >> d) & 1) ? x[d] : 1.0 - x[d];
+    const auto node = NodePosition(CubedSphereNode(tree, b));
+    for (int d = 0; d < 3; ++d)
+      pos[d] += w * node[d];
+  }
+  return pos;
+}
+
+int CheckCubedSphereGhosts(MeshData<Real> *md) {
+  IndexRange ib = md->GetBoundsI(IndexDomain::interior);
+  IndexRange jb = md->GetBoundsJ(IndexDomain::interior);
+  IndexRange kb = md->GetBoundsK(IndexDomain::interior);
+  const std::array<IndexRange, 3> bounds{ib, jb, kb};
+  int nwrong = 0;
+  for (int b = 0; b < md->NumBlocks(); ++b) {
+    auto pmb = md->GetBlockData(b)->GetBlockPointer();
+    auto data_h =
+        md->GetBlockData(b)->Get(position::name()).data.GetHostMirrorAndCopy();
+    const int tree = pmb->loc.tree();
+    const int level = pmb->loc.level();
+    const int nx = pmb->block_size.nx(X1DIR);
+    const std::array<int, 3> lx{static_cast<int>(pmb->loc.lx1()),
+                                static_cast<int>(pmb->loc.lx2()),
+                                static_cast<int>(pmb->loc.lx3())};
+    for (int k = 0; k < data_h.GetDim(3); ++k) {
+      for (int j = 0; j < data_h.GetDim(2); ++j) {
+        for (int i = 0; i < data_h.GetDim(1); ++i) {
+          const std::array<int, 3> ijk{i, j, k};
+          std::array<int, 3> offsets;
+          std::array<Real, 3> x;
+          for (int d = 0; d < 3; ++d) {
+            offsets[d] = (ijk[d] < bounds[d].s) ? -1 : ((ijk[d] > bounds[d].e) ? 1 : 0);
+            x[d] = (lx[d] * nx + ijk[d] - bounds[d].s + 0.5) / (nx << level);
+          }
+          // Skip the interior, the ghosts set by the boundary conditions of the inner
+          // and outer cube, and the ghosts diagonally across the edges where three
+          // trees meet, which have no neighbor
+          const bool out_x1 = x[0] < 0.0 || x[0] > 1.0;
+          const bool out_x2 = x[1] < 0.0 || x[1] > 1.0;
+          if (offsets == std::array<int, 3>{0, 0, 0} || offsets[2] != 0 ||
+              (out_x1 && out_x2))
+            continue;
+
+          // The ghosts are filled from blocks on the coarser of the two levels
+          int source_level = -1;
+          for (const auto &nb : pmb->neighbors) {
+            if (nb.offsets(X1DIR) == offsets[0] && nb.offsets(X2DIR) == offsets[1] &&
+                nb.offsets(X3DIR) == offsets[2])
+              source_level = std::min(level, nb.loc.level());
+          }
+          if (source_level < 0) {
+            nwrong++;
+            continue;
+          }
+
+          // Every face between trees is a mirror plane of the shell that maps one tree
+          // onto the other, so a ghost across it has the mirror image of the position
+          // of the cell it mirrors in this tree
+          int crossed_dir = -1;
+          int crossed_side = 0;
+          for (int d = 0; d < 2; ++d) {
+            if (x[d] < 0.0 || x[d] > 1.0) {
+              crossed_dir = d;
+              crossed_side = x[d] > 1.0;
+              x[d] = crossed_side ? 2.0 - x[d] : -x[d];
+            }
+          }
+          const int ncells = nx << source_level;
+          for (int d = 0; d < 3; ++d)
+            x[d] = (std::floor(x[d] * ncells) + 0.5) / ncells;
+          auto expected = CubedSpherePosition(tree, x);
+          if (crossed_dir >= 0) {
+            // The mirror plane contains the origin and the shared face
+            std::array<Real, 3> p[2];
+            for (int e = 0; e < 2; ++e) {
+              const int bnode = (crossed_side << crossed_dir) | (e << (1 - crossed_dir));
+              p[e] = NodePosition(CubedSphereNode(tree, bnode));
+            }
+            std::array<Real, 3> normal{p[0][1] * p[1][2] - p[0][2] * p[1][1],
+                                       p[0][2] * p[1][0] - p[0][0] * p[1][2],
+                                       p[0][0] * p[1][1] - p[0][1] * p[1][0]};
+            const Real norm = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] +
+                                        normal[2] * normal[2]);
+            Real dot = 0.0;
+            for (int d = 0; d < 3; ++d) {
+              normal[d] /= norm;
+              dot += expected[d] * normal[d];
+            }
+            for (int d = 0; d < 3; ++d)
+              expected[d] -= 2.0 * dot * normal[d];
+          }
+
+          for (int d = 0; d < 3; ++d) {
+            // NaN, i.e. ghosts that were not filled, also fail this check
+            if (!(std::abs(data_h(d, k, j, i) - expected[d]) < 1.e-12)) {
+              nwrong++;
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+  return nwrong;
+}
+
 std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin) {
   auto package = std::make_shared<StateDescriptor>("boundary_exchange");
   Params &params = package->AllParams();
@@ -111,6 +385,30 @@ std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin) {
                           parthenon::refinement_ops::RestrictAverage>();
   package->AddField(neighbor_info::name(), m);
 
+  // Optionally check the ghost zones across the faces between the trees of a cubed
+  // sphere shell
+  const bool cubed_sphere =
+      pin->GetOrAddBoolean("boundary_exchange", "cubed_sphere", false);
+  params.Add("cubed_sphere", cubed_sphere);
+  if (cubed_sphere) {
+    Metadata m_pos({Metadata::Cell, Metadata::Independent, Metadata::FillGhost},
+                   std::vector<int>{3});
+    m_pos.RegisterRefinementOps<parthenon::refinement_ops::ProlongatePiecewiseConstant,
+                                parthenon::refinement_ops::RestrictAverage>();
+    package->AddField<position>(m_pos);
+  }
+
+  // Optionally check that variables with a reduced ghost depth only have that many
+  // ghost zones filled by boundary communication
+  const int ghost_depth = pin->GetOrAddInteger("boundary_exchange", "ghost_depth", 0);
+  params.Add("ghost_depth", ghost_depth);
+  if (ghost_depth > 0) {
+    Metadata m_depth({Metadata::Cell, Metadata::Independent, Metadata::FillGhost});
+    package->AddField<full_depth>(m_depth);
+    m_depth.SetGhostDepth(ghost_depth);
+    package->AddField<reduced_depth>(m_depth);
+  }
+
   return package;
 }
 
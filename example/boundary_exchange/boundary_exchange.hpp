@@ -14,6 +14,7 @@
 #define EXAMPLE_BOUNDARY_EXCHANGE_BOUNDARY_EXCHANGE_HPP_
 
 // Standard Includes
+#include <array>
 #include <memory>
 #include <string>
 #include <utility>
@@ -21,6 +22,7 @@
 
 // Parthenon Includes
 #include <interface/state_descriptor.hpp>
+#include <mesh/forest/forest.hpp>
 #include <parthenon/package.hpp>
 
 namespace boundary_exchange {
@@ -34,7 +36,43 @@ struct neighbor_info : public parthenon::variable_names::base_t<false, 4> {
   static std::string name() { return "neighbor_info"; }
 };
 
+// Variables with the same values in their interiors that are communicated with all
+// ghost zones and with the depth set by boundary_exchange/ghost_depth, respectively
+struct full_depth : public parthenon::variable_names::base_t<false> {
+  template <class... Ts>
+  KOKKOS_INLINE_FUNCTION full_depth(Ts &&...args)
+      : parthenon::variable_names::base_t<false>(std::forward<Ts>(args)...) {}
+  static std::string name() { return "full_depth"; }
+};
+struct reduced_depth : public parthenon::variable_names::base_t<false> {
+  template <class... Ts>
+  KOKKOS_INLINE_FUNCTION reduced_depth(Ts &&...args)
+      : parthenon::variable_names::base_t<false>(std::forward<Ts>(args)...) {}
+  static std::string name() { return "reduced_depth"; }
+};
+
 TaskStatus SetBlockValues(MeshData<Real> *rc);
+// Number of ghost cells in which the reduced depth variable was not filled like the
+// full depth one, or was filled beyond its ghost depth
+int CheckGhostDepth(MeshData<Real> *md);
+
+// Cartesian position of the cell centers on a cubed sphere shell
+struct position : public parthenon::variable_names::base_t<false, 4> {
+  template <class... Ts>
+  KOKKOS_INLINE_FUNCTION position(Ts &&...args)
+      : parthenon::variable_names::base_t<false, 4>(std::forward<Ts>(args)...) {}
+  static std::string name() { return "position"; }
+};
+
+// Shell between two cubes made of six trees that are rotated and reflected with respect
+// to each other. The first tree is refined twice next to one of its neighbors.
+parthenon::forest::ForestDefinition MakeCubedSphereForest();
+// Cartesian position of the point with logical coordinates x in [0, 1]^3 in a tree of
+// the cubed sphere shell
+std::array<Real, 3> CubedSpherePosition(int tree, const std::array<Real, 3> &x);
+// Number of ghost cells whose position differs from that of the cells they should have
+// been filled from, including those across faces between trees
+int CheckCubedSphereGhosts(MeshData<Real> *md);
 std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin);
 
 } // namespace boundary_exchange
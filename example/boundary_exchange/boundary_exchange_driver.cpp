@@ -13,6 +13,7 @@
 
 // Standard Includes
 #include <fstream>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -33,6 +34,7 @@ using namespace parthenon::driver::prelude;
 using boundary_exchange::BoundaryExchangeDriver;
 
 Packages_t ProcessPackages(std::unique_ptr<ParameterInput> &pin);
+parthenon::forest::ForestDefinition MakeFourTreeForest();
 
 int main(int argc, char *argv[]) {
   ParthenonManager pman;
@@ -52,6 +54,35 @@ int main(int argc, char *argv[]) {
     return 1;
   }
 
+  // The forest is made of four two dimensional trees, or of six three dimensional trees
+  // that form a cubed sphere shell
+  auto forest_def =
+      pman.pinput->GetOrAddBoolean("boundary_exchange", "cubed_sphere", false)
+          ? boundary_exchange::MakeCubedSphereForest()
+          : MakeFourTreeForest();
+  pman.ParthenonInitPackagesAndMesh(forest_def);
+
+  // This needs to be scoped so that the driver object is destructed before Finalize
+  {
+    BoundaryExchangeDriver driver(pman.pinput.get(), pman.app_input.get(),
+                                  pman.pmesh.get());
+
+    auto driver_status = driver.Execute();
+  }
+  // call MPI_Finalize if necessary
+  pman.ParthenonFinalize();
+
+  return 0;
+}
+
+Packages_t ProcessPackages(std::unique_ptr<ParameterInput> &pin) {
+  Packages_t packages;
+  // only have one package for this app, but will typically have more things added to
+  packages.Add(boundary_exchange::Initialize(pin.get()));
+  return packages;
+}
+
+parthenon::forest::ForestDefinition MakeFourTreeForest() {
   // Create the nodes for the forest, the x-y positions are only used for
   // visualizing the forest configuration and *do not* determine the global
   // coordinates of the trees.
@@ -95,26 +126,7 @@ int main(int argc, char *argv[]) {
   forest_def.AddBC(edge_t({n[7], n[8]}), parthenon::BoundaryFlag::outflow);
 
   forest_def.AddInitialRefinement(parthenon::LogicalLocation(0, 1, 0, 0, 0));
-  pman.ParthenonInitPackagesAndMesh(forest_def);
-
-  // This needs to be scoped so that the driver object is destructed before Finalize
-  {
-    BoundaryExchangeDriver driver(pman.pinput.get(), pman.app_input.get(),
-                                  pman.pmesh.get());
-
-    auto driver_status = driver.Execute();
-  }
-  // call MPI_Finalize if necessary
-  pman.ParthenonFinalize();
-
-  return 0;
-}
-
-Packages_t ProcessPackages(std::unique_ptr<ParameterInput> &pin) {
-  Packages_t packages;
-  // only have one package for this app, but will typically have more things added to
-  packages.Add(boundary_exchange::Initialize(pin.get()));
-  return packages;
+  return forest_def;
 }
 
 // this should set up initial conditions of independent variables on the block
@@ -124,6 +136,27 @@ Packages_t ProcessPackages(std::unique_ptr<ParameterInput> &pin) {
 //  // nothing to do here for this app
 //}
 
+namespace {
+// Sums the number of wrong ghost cells found by check over all partitions and ranks and
+// reports it on the first rank
+int CountWrongGhosts(Mesh *pmesh, const std::string &label,
+                     int (*check)(MeshData<Real> *)) {
+  int nwrong = 0;
+  for (int i = 0; i < pmesh->DefaultNumPartitions(); i++) {
+    auto &md = pmesh->mesh_data.GetOrAdd("base", i);
+    nwrong += check(md.get());
+  }
+#ifdef MPI_PARALLEL
+  PARTHENON_MPI_CHECK(
+      MPI_Allreduce(MPI_IN_PLACE, &nwrong, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD));
+#endif
+  if (parthenon::Globals::my_rank == 0) {
+    std::cout << label << ": " << nwrong << " wrong ghost cells" << std::endl;
+  }
+  return nwrong;
+}
+} // namespace
+
 parthenon::DriverStatus BoundaryExchangeDriver::Execute() {
   // this is where the main work is orchestrated
   // No evolution in this driver.  Just calculates something once.
@@ -134,7 +167,18 @@ parthenon::DriverStatus BoundaryExchangeDriver::Execute() {
   ConstructAndExecuteTaskLists<>(this);
   pouts->MakeOutputs(pmesh, pinput);
 
-  return DriverStatus::complete;
+  auto pkg = pmesh->packages.Get("boundary_exchange");
+  int nwrong = 0;
+  if (pkg->Param<int>("ghost_depth") > 0) {
+    nwrong += CountWrongGhosts(pmesh, "Ghost depth check",
+                               boundary_exchange::CheckGhostDepth);
+  }
+  if (pkg->Param<bool>("cubed_sphere")) {
+    nwrong += CountWrongGhosts(pmesh, "Cubed sphere check",
+                               boundary_exchange::CheckCubedSphereGhosts);
+  }
+
+  return (nwrong > 0) ? DriverStatus::failed : DriverStatus::complete;
 }
 
 template <typename T>
@@ -151,15 +151,16 @@ TaskCollection AdvectionDriver::MakeTaskCollection(BlockList_t &blocks, const in
     auto boundaries = parthenon::AddBoundaryExchangeTasks(
         update | update_vec | update_fine | start_send, tl, mc1, pmesh->multilevel);
 
-    auto fill_derived =
-        tl.AddTask(boundaries, parthenon::Update::FillDerived<MeshData<Real>>, mc1.get());
-
     if (stage == integrator->nstages) {
-      auto new_dt = tl.AddTask(fill_derived, EstimateTimestep<MeshData<Real>>, mc1.get());
+      auto new_dt = tl.AddTask(
+          boundaries, parthenon::Update::FillDerivedAndEstimateTimestep<MeshData<Real>>,
+          mc1.get());
       if (pmesh->adaptive) {
         auto tag_refine =
             tl.AddTask(new_dt, parthenon::Refinement::Tag<MeshData<Real>>, mc1.get());
       }
+    } else {
+      tl.AddTask(boundaries, parthenon::Update::FillDerived<MeshData<Real>>, mc1.get());
     }
   }
 
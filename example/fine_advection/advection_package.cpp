@@ -95,7 +95,7 @@ std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin) {
       Metadata({Metadata::Cell, Metadata::Derived, Metadata::OneCopy}));
 
   pkg->CheckRefinementBlock = CheckRefinement;
-  pkg->EstimateTimestepMesh = EstimateTimestep;
+  pkg->EstimateTimestepMeshOnDevice = EstimateTimestep;
   pkg->FillDerivedMesh = FillDerived;
   return pkg;
 }
@@ -133,7 +133,7 @@ AmrTag CheckRefinement(MeshBlockData<Real> *rc) {
   return AmrTag::same;
 }
 
-Real EstimateTimestep(MeshData<Real> *md) {
+void EstimateTimestep(MeshData<Real> *md, ParArray0D<Real> dt_min) {
   std::shared_ptr<StateDescriptor> pkg =
       md->GetMeshPointer()->packages.Get("advection_package");
   const auto &cfl = pkg->Param<Real>("cfl");
@@ -148,23 +148,35 @@ Real EstimateTimestep(MeshData<Real> *md) {
   IndexRange jb = md->GetBoundsJ(IndexDomain::interior);
   IndexRange kb = md->GetBoundsK(IndexDomain::interior);
 
-  // This is obviously overkill for this constant velocity problem
-  Real min_dt;
-  parthenon::par_reduce(
-      parthenon::loop_pattern_mdrange_tag, PARTHENON_AUTO_LABEL, DevExecSpace(), 0,
-      pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
-      KOKKOS_LAMBDA(const int b, const int k, const int j, const int i, Real &lmin_dt) {
+  // This is obviously overkill for this constant velocity problem.
+  // The result stays on device, so the reduction does not block. Each block combines
+  // its minimum with the estimate already in dt_min instead of overwriting it.
+  const Real fac = 0.5 * cfl;
+  const int nj = jb.e - jb.s + 1;
+  const int ni = ib.e - ib.s + 1;
+  const int ncells = (kb.e - kb.s + 1) * nj * ni;
+  parthenon::par_for_outer(
+      DEFAULT_OUTER_LOOP_PATTERN, PARTHENON_AUTO_LABEL, md->exec_space, 0, 0, 0,
+      pack.GetNBlocks() - 1, KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int b) {
         auto &coords = pack.GetCoordinates(b);
-        lmin_dt = std::min(
-            lmin_dt, parthenon::robust::ratio(coords.Dxc<X1DIR>(k, j, i), std::abs(vx)));
-        lmin_dt = std::min(
-            lmin_dt, parthenon::robust::ratio(coords.Dxc<X2DIR>(k, j, i), std::abs(vy)));
-        lmin_dt = std::min(
-            lmin_dt, parthenon::robust::ratio(coords.Dxc<X3DIR>(k, j, i), std::abs(vz)));
-      },
-      Kokkos::Min<Real>(min_dt));
-
-  return cfl * min_dt / 2.0;
+        Real block_dt = std::numeric_limits<Real>::max();
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange<>(member, ncells),
+            [&](const int idx, Real &lmin_dt) {
+              const int k = kb.s + idx / (nj * ni);
+              const int j = jb.s + (idx % (nj * ni)) / ni;
+              const int i = ib.s + idx % ni;
+              auto dt = [&](const Real dx, const Real v) {
+                return fac * parthenon::robust::ratio(dx, std::abs(v));
+              };
+              lmin_dt = std::min(lmin_dt, dt(coords.Dxc<X1DIR>(k, j, i), vx));
+              lmin_dt = std::min(lmin_dt, dt(coords.Dxc<X2DIR>(k, j, i), vy));
+              lmin_dt = std::min(lmin_dt, dt(coords.Dxc<X3DIR>(k, j, i), vz));
+            },
+            Kokkos::Min<Real>(block_dt));
+        Kokkos::single(Kokkos::PerTeam(member),
+                       [&]() { Kokkos::atomic_min(&dt_min(), block_dt); });
+      });
 }
 
 TaskStatus FillDerived(MeshData<Real> *md) {
@@ -48,7 +48,7 @@ VARIABLE(advection, divD);
 
 std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin);
 AmrTag CheckRefinement(MeshBlockData<Real> *rc);
-Real EstimateTimestep(MeshData<Real> *md);
+void EstimateTimestep(MeshData<Real> *md, ParArray0D<Real> dt_min);
 TaskStatus FillDerived(MeshData<Real> *md);
 
 template <class pack_desc_t>
@@ -466,34 +466,17 @@ TaskStatus TransportParticles(MeshBlock *pmb, const StagedIntegrator *integrator
   return TaskStatus::complete;
 }
 
-// Custom step function to allow for looping over MPI-related tasks until complete
+// Custom step function separating particle creation, transport, and finalization
 TaskListStatus ParticleDriver::Step() {
   TaskListStatus status;
   integrator.dt = tm.dt;
 
-  BlockList_t &blocks = pmesh->block_list;
-  auto num_task_lists_executed_independently = blocks.size();
-
   // Create all the particles that will be created during the step
   status = MakeParticlesCreationTaskCollection().Execute();
 
-  // Loop over repeated MPI calls until every particle is finished. This logic is
-  // required because long-distance particle pushes can lead to a large, unpredictable
-  // number of MPI sends and receives.
-  bool particles_update_done = false;
-  while (!particles_update_done) {
-    status = MakeParticlesUpdateTaskCollection().Execute();
-
-    particles_update_done = true;
-    for (auto &block : blocks) {
-      // TODO(BRR) Despite this "my_particles"-specific call, this function feels like it
-      // should be generalized
-      auto swarm = block->meshblock_data.Get()->GetSwarmData()->Get("my_particles");
-      if (!swarm->finished_transport) {
-        particles_update_done = false;
-      }
-    }
-  }
+  // Transport and exchange particles until every particle is finished, see
+  // MakeParticlesUpdateTaskCollection
+  status = MakeParticlesUpdateTaskCollection().Execute();
 
   // Use a more traditional task list for predictable post-MPI evaluations.
   status = MakeFinalizationTaskCollection().Execute();
@@ -501,65 +484,6 @@ TaskListStatus ParticleDriver::Step() {
   return status;
 }
 
-// TODO(BRR) This should really be in parthenon/src... but it can't just live in Swarm
-// because of the loop over blocks
-TaskStatus StopCommunicationMesh(const BlockList_t &blocks) {
-  PARTHENON_INSTRUMENT
-
-  int num_sent_local = 0;
-  for (auto &block : blocks) {
-    auto sc = block->meshblock_data.Get()->GetSwarmData();
-    auto swarm = sc->Get("my_particles");
-    swarm->finished_transport = false;
-    num_sent_local += swarm->num_particles_sent_;
-  }
-
-  int num_sent_global = num_sent_local; // potentially overwritten by following Allreduce
-#ifdef MPI_PARALLEL
-  for (auto &block : blocks) {
-    auto swarm = block->meshblock_data.Get()->GetSwarmData()->Get("my_particles");
-    for (int n = 0; n < block->neighbors.size(); n++) {
-      NeighborBlock &nb = block->neighbors[n];
-      // TODO(BRR) May want logic like this if we have non-blocking TaskRegions
-      // if (nb.snb.rank != Globals::my_rank) {
-      //  if (swarm->vbswarm->bd_var_.flag[nb.bufid] != BoundaryStatus::completed) {
-      //    return TaskStatus::incomplete;
-      //  }
-      //}
-
-      // TODO(BRR) May want to move this logic into a per-cycle initialization call
-      if (swarm->vbswarm->bd_var_.flag[nb.bufid] == BoundaryStatus::completed) {
-        swarm->vbswarm->bd_var_.req_send[nb.bufid] = MPI_REQUEST_NULL;
-      }
-    }
-  }
-
-  MPI_Allreduce(&num_sent_local, &num_sent_global, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
-#endif // MPI_PARALLEL
-
-  if (num_sent_global == 0) {
-    for (auto &block : blocks) {
-      auto &pmb = block;
-      auto sc = pmb->meshblock_data.Get()->GetSwarmData();
-      auto swarm = sc->Get("my_particles");
-      swarm->finished_transport = true;
-    }
-  }
-
-  // Reset boundary statuses
-  for (auto &block : blocks) {
-    auto &pmb = block;
-    auto sc = pmb->meshblock_data.Get()->GetSwarmData();
-    auto swarm = sc->Get("my_particles");
-    for (int n = 0; n < pmb->neighbors.size(); n++) {
-      auto &nb = block->neighbors[n];
-      swarm->vbswarm->bd_var_.flag[nb.bufid] = BoundaryStatus::waiting;
-    }
-  }
-
-  return TaskStatus::complete;
-}
-
 TaskCollection ParticleDriver::MakeParticlesCreationTaskCollection() const {
   TaskCollection tc;
   TaskID none(0);
@@ -581,31 +505,29 @@ TaskCollection ParticleDriver::MakeParticlesUpdateTaskCollection() const {
   TaskCollection tc;
   TaskID none(0);
   const double t0 = tm.time;
-  const BlockList_t &blocks = pmesh->block_list;
-
-  auto num_task_lists_executed_independently = blocks.size();
-
-  TaskRegion &async_region0 = tc.AddRegion(num_task_lists_executed_independently);
-  for (int i = 0; i < blocks.size(); i++) {
-    auto &pmb = blocks[i];
-
-    auto &sc = pmb->meshblock_data.Get()->GetSwarmData();
 
+  // Long-distance particle pushes can lead to a large, unpredictable number of hops
+  // across blocks. Each round transports the particles on every block of a partition as
+  // far as they get, exchanges them, and applies boundary conditions to the whole
+  // partition. Rounds are repeated until no particle was sent on any rank, which is
+  // detected by a non-blocking reduction rather than a blocking one per round.
+  auto partitions = pmesh->GetDefaultBlockPartitions();
+  TaskRegion &async_region0 = tc.AddRegion(partitions.size());
+  for (int i = 0; i < partitions.size(); i++) {
+    auto &md = pmesh->mesh_data.Add("base", partitions[i]);
     auto &tl = async_region0[i];
 
-    auto transport_particles =
-        tl.AddTask(none, TransportParticles, pmb.get(), &integrator, t0);
-
-    auto send = tl.AddTask(transport_particles, &SwarmContainer::Send, sc.get(),
-                           BoundaryCommSubset::all);
-    auto receive =
-        tl.AddTask(send, &SwarmContainer::Receive, sc.get(), BoundaryCommSubset::all);
-  }
-
-  TaskRegion &sync_region0 = tc.AddRegion(1);
-  {
-    auto &tl = sync_region0[0];
-    auto stop_comm = tl.AddTask(none, StopCommunicationMesh, blocks);
+    auto [itl, exchange] = tl.AddSublist(none, {1, std::numeric_limits<int>::max()});
+    TaskID sends(0);
+    for (auto &pmb : partitions[i]) {
+      auto &sc = pmb->meshblock_data.Get()->GetSwarmData();
+      auto transport_particles =
+          itl.AddTask(none, TransportParticles, pmb.get(), &integrator, t0);
+      sends = sends | itl.AddTask(transport_particles, &SwarmContainer::Send, sc.get(),
+                                  BoundaryCommSubset::all);
+    }
+    auto receive = itl.AddTask(sends, ReceiveSwarmsMD, md, BoundaryCommSubset::all);
+    itl.AddTask(TaskQualifier::completion, receive, FinalizeSwarmCommsIterativeMD, md);
   }
 
   return tc;
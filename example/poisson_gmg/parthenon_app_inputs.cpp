@@ -40,6 +40,8 @@ void ProblemGenerator(Mesh *pm, ParameterInput *pin, MeshData<Real> *md) {
   Real radius0 = pin->GetOrAddReal("poisson", "radius", 0.1);
   Real interior_D = pin->GetOrAddReal("poisson", "interior_D", 1.0);
   Real exterior_D = pin->GetOrAddReal("poisson", "exterior_D", 1.0);
+  // Ratio of D on x1 faces to D on the other faces, which makes the problem anisotropic
+  Real anisotropy = pin->GetOrAddReal("poisson", "anisotropy", 1.0);
 
   auto desc =
       parthenon::MakePackDescriptor<poisson_package::rhs, poisson_package::u,
@@ -93,7 +95,7 @@ void ProblemGenerator(Mesh *pm, ParameterInput *pin, MeshData<Real> *md) {
           return inside1 || inside2;
         };
         pack(b, TE::F1, poisson_package::D(), k, j, i) =
-            inside_region(x1f, x2, x3) ? interior_D : exterior_D;
+            anisotropy * (inside_region(x1f, x2, x3) ? interior_D : exterior_D);
         pack(b, TE::F2, poisson_package::D(), k, j, i) =
             inside_region(x1, x2f, x3) ? interior_D : exterior_D;
         pack(b, TE::F3, poisson_package::D(), k, j, i) =
@@ -20,6 +20,7 @@
 
 #include <kokkos_abstraction.hpp>
 #include <parthenon/package.hpp>
+#include <solvers/solver_utils.hpp>
 
 #include "poisson_package.hpp"
 
@@ -28,34 +29,41 @@ namespace poisson_package {
 // This class implement methods for calculating A.x = y and returning the diagonal of A,
 // where A is the the matrix representing the discretized Poisson equation on the grid.
 // Here we implement the Laplace operator in terms of a flux divergence to (potentially)
-// consistently deal with coarse fine boundaries on the grid. Only the routines Ax and
-// SetDiagonal need to be defined for interfacing this with solvers. The other methods
-// are internal, but can't be marked private or protected because they launch kernels
-// on device.
+// consistently deal with coarse fine boundaries on the grid. With a non-zero
+// nonlinear_beta, A(u) includes the term -beta u^3 and SetDiagonal returns the diagonal
+// of its Jacobian at the current u. Only the routines Ax and SetDiagonal need to be
+// defined for interfacing this with solvers, SetLineOffDiagonals is only required by
+// the line relaxation smoother. The other methods are internal, but can't be marked
+// private or protected because they launch kernels on device.
 class PoissonEquation {
  public:
+  using OperatorRegion = parthenon::solvers::OperatorRegion;
   bool do_flux_cor = false;
 
   // Add tasks to calculate the result of the matrix A (which is implicitly defined by
-  // this class) being applied to x_t and store it in field out_t
+  // this class) being applied to x_t and store it in field out_t. Restricted to the
+  // boundary cells, this requires A x_t to have been calculated for the interior cells.
   template <class x_t, class out_t, class TL_t>
   parthenon::TaskID Ax(TL_t &tl, parthenon::TaskID depends_on,
-                       std::shared_ptr<parthenon::MeshData<Real>> &md) {
-    auto flux_res = tl.AddTask(depends_on, CalculateFluxes<x_t>, md);
-    if (do_flux_cor && !(md->grid.type == parthenon::GridType::two_level_composite)) {
+                       std::shared_ptr<parthenon::MeshData<Real>> &md,
+                       OperatorRegion region = OperatorRegion::all) {
+    auto flux_res = tl.AddTask(depends_on, CalculateFluxes<x_t>, md, region);
+    // Only the fluxes on block faces are corrected
+    if (do_flux_cor && region != OperatorRegion::interior &&
+        !(md->grid.type == parthenon::GridType::two_level_composite)) {
       auto start_flxcor =
           tl.AddTask(flux_res, parthenon::StartReceiveFluxCorrections, md);
       auto send_flxcor = tl.AddTask(flux_res, parthenon::LoadAndSendFluxCorrections, md);
       auto recv_flxcor = tl.AddTask(start_flxcor, parthenon::ReceiveFluxCorrections, md);
       flux_res = tl.AddTask(recv_flxcor, parthenon::SetFluxCorrections, md);
     }
-    return tl.AddTask(flux_res, FluxMultiplyMatrix<x_t, out_t>, md);
+    return tl.AddTask(flux_res, FluxMultiplyMatrix<x_t, out_t>, md, region);
   }
 
-  // Calculate an approximation to the diagonal of the matrix A and store it in diag_t.
-  // For a uniform grid or when flux correction is ignored, this diagonal calculation
-  // is exact. Exactness is (probably) not required since it is just used in Jacobi
-  // iterations.
+  // Calculate an approximation to the diagonal of the matrix A (of the Jacobian of A at
+  // the current u for the nonlinear operator) and store it in diag_t. For a uniform
+  // grid or when flux correction is ignored, this diagonal calculation is exact.
+  // Exactness is (probably) not required since it is just used in Jacobi iterations.
   template <class diag_t>
   parthenon::TaskStatus SetDiagonal(std::shared_ptr<parthenon::MeshData<Real>> &md) {
     using namespace parthenon;
@@ -68,11 +76,12 @@ class PoissonEquation {
 
     auto pkg = md->GetMeshPointer()->packages.Get("poisson_package");
     const auto alpha = pkg->Param<Real>("diagonal_alpha");
+    const auto beta = pkg->Param<Real>("nonlinear_beta");
 
     int nblocks = md->NumBlocks();
     std::vector<bool> include_block(nblocks, true);
 
-    auto desc = parthenon::MakePackDescriptor<diag_t, D>(md.get());
+    auto desc = parthenon::MakePackDescriptor<diag_t, D, u>(md.get());
     auto pack = desc.GetPack(md.get(), include_block);
     parthenon::par_for(
         "StoreDiagonal", 0, pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
@@ -80,10 +89,11 @@ class PoissonEquation {
           const auto &coords = pack.GetCoordinates(b);
           // Build the unigrid diagonal of the matrix
           Real dx1 = coords.template Dxc<X1DIR>(k, j, i);
+          const Real x = pack(b, te, u(), k, j, i);
           Real diag_elem =
               -(pack(b, TE::F1, D(), k, j, i) + pack(b, TE::F1, D(), k, j, i + 1)) /
                   (dx1 * dx1) -
-              alpha;
+              alpha - 3.0 * beta * x * x;
           if (ndim > 1) {
             Real dx2 = coords.template Dxc<X2DIR>(k, j, i);
             diag_elem -=
@@ -101,9 +111,48 @@ class PoissonEquation {
     return TaskStatus::complete;
   }
 
+  // Store the elements of A coupling each cell to its lower and upper neighbors in
+  // direction dir, which are required by the line relaxation smoother. Like the
+  // diagonal, these ignore flux correction at coarse fine boundaries.
+  template <class lower_t, class upper_t>
+  parthenon::TaskStatus
+  SetLineOffDiagonals(std::shared_ptr<parthenon::MeshData<Real>> &md, int dir) {
+    using namespace parthenon;
+    using TE = parthenon::TopologicalElement;
+    TE te = TE::CC;
+    IndexRange ib = md->GetBoundsI(IndexDomain::interior, te);
+    IndexRange jb = md->GetBoundsJ(IndexDomain::interior, te);
+    IndexRange kb = md->GetBoundsK(IndexDomain::interior, te);
+
+    int nblocks = md->NumBlocks();
+    std::vector<bool> include_block(nblocks, true);
+
+    const TE tef = (dir == X1DIR) ? TE::F1 : (dir == X2DIR) ? TE::F2 : TE::F3;
+    const int di = (dir == X1DIR);
+    const int dj = (dir == X2DIR);
+    const int dk = (dir == X3DIR);
+
+    auto desc = parthenon::MakePackDescriptor<lower_t, upper_t, D>(md.get());
+    auto pack = desc.GetPack(md.get(), include_block);
+    parthenon::par_for(
+        "StoreLineOffDiagonals", 0, pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s,
+        ib.e, KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
+          const auto &coords = pack.GetCoordinates(b);
+          Real dx = coords.template Dxc<X1DIR>(k, j, i);
+          if (dir == X2DIR) dx = coords.template Dxc<X2DIR>(k, j, i);
+          if (dir == X3DIR) dx = coords.template Dxc<X3DIR>(k, j, i);
+          pack(b, te, lower_t(), k, j, i) = pack(b, tef, D(), k, j, i) / (dx * dx);
+          pack(b, te, upper_t(), k, j, i) =
+              pack(b, tef, D(), k + dk, j + dj, i + di) / (dx * dx);
+        });
+    return TaskStatus::complete;
+  }
+
+  // Fluxes on faces inside of the blocks are calculated for OperatorRegion::interior and
+  // fluxes on block faces for OperatorRegion::boundary
   template <class var_t>
   static parthenon::TaskStatus
-  CalculateFluxes(std::shared_ptr<parthenon::MeshData<Real>> &md) {
+  CalculateFluxes(std::shared_ptr<parthenon::MeshData<Real>> &md, OperatorRegion region) {
     using namespace parthenon;
     const int ndim = md->GetMeshPointer()->ndim;
     using TE = parthenon::TopologicalElement;
@@ -117,6 +166,9 @@ class PoissonEquation {
     int nblocks = md->NumBlocks();
     std::vector<bool> include_block(nblocks, true);
 
+    const bool do_interior = region != OperatorRegion::boundary;
+    const bool do_boundary = region != OperatorRegion::interior;
+
     auto desc =
         parthenon::MakePackDescriptor<var_t, D>(md.get(), {}, {PDOpt::WithFluxes});
     auto pack = desc.GetPack(md.get(), include_block);
@@ -125,20 +177,23 @@ class PoissonEquation {
         KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
           const auto &coords = pack.GetCoordinates(b);
           Real dx1 = coords.template Dxc<X1DIR>(k, j, i);
-          pack.flux(b, X1DIR, var_t(), k, j, i) =
-              pack(b, TE::F1, D(), k, j, i) / dx1 *
-              (pack(b, te, var_t(), k, j, i - 1) - pack(b, te, var_t(), k, j, i));
-          if (i == ib.e)
+          if (i == ib.s ? do_boundary : do_interior)
+            pack.flux(b, X1DIR, var_t(), k, j, i) =
+                pack(b, TE::F1, D(), k, j, i) / dx1 *
+                (pack(b, te, var_t(), k, j, i - 1) - pack(b, te, var_t(), k, j, i));
+          if (i == ib.e && do_boundary)
             pack.flux(b, X1DIR, var_t(), k, j, i + 1) =
                 pack(b, TE::F1, D(), k, j, i + 1) / dx1 *
                 (pack(b, te, var_t(), k, j, i) - pack(b, te, var_t(), k, j, i + 1));
 
           if (ndim > 1) {
             Real dx2 = coords.template Dxc<X2DIR>(k, j, i);
-            pack.flux(b, X2DIR, var_t(), k, j, i) =
-                pack(b, TE::F2, D(), k, j, i) *
-                (pack(b, te, var_t(), k, j - 1, i) - pack(b, te, var_t(), k, j, i)) / dx2;
-            if (j == jb.e)
+            if (j == jb.s ? do_boundary : do_interior)
+              pack.flux(b, X2DIR, var_t(), k, j, i) =
+                  pack(b, TE::F2, D(), k, j, i) *
+                  (pack(b, te, var_t(), k, j - 1, i) - pack(b, te, var_t(), k, j, i)) /
+                  dx2;
+            if (j == jb.e && do_boundary)
               pack.flux(b, X2DIR, var_t(), k, j + 1, i) =
                   pack(b, TE::F2, D(), k, j + 1, i) *
                   (pack(b, te, var_t(), k, j, i) - pack(b, te, var_t(), k, j + 1, i)) /
@@ -147,10 +202,12 @@ class PoissonEquation {
 
           if (ndim > 2) {
             Real dx3 = coords.template Dxc<X3DIR>(k, j, i);
-            pack.flux(b, X3DIR, var_t(), k, j, i) =
-                pack(b, TE::F3, D(), k, j, i) *
-                (pack(b, te, var_t(), k - 1, j, i) - pack(b, te, var_t(), k, j, i)) / dx3;
-            if (k == kb.e)
+            if (k == kb.s ? do_boundary : do_interior)
+              pack.flux(b, X3DIR, var_t(), k, j, i) =
+                  pack(b, TE::F3, D(), k, j, i) *
+                  (pack(b, te, var_t(), k - 1, j, i) - pack(b, te, var_t(), k, j, i)) /
+                  dx3;
+            if (k == kb.e && do_boundary)
               pack.flux(b, X2DIR, var_t(), k + 1, j, i) =
                   pack(b, TE::F3, D(), k + 1, j, i) *
                   (pack(b, te, var_t(), k, j, i) - pack(b, te, var_t(), k + 1, j, i)) /
@@ -164,7 +221,8 @@ class PoissonEquation {
   // calculated with in_t (which have possibly been corrected at coarse fine boundaries)
   template <class in_t, class out_t>
   static parthenon::TaskStatus
-  FluxMultiplyMatrix(std::shared_ptr<parthenon::MeshData<Real>> &md) {
+  FluxMultiplyMatrix(std::shared_ptr<parthenon::MeshData<Real>> &md,
+                     OperatorRegion region) {
     using namespace parthenon;
     const int ndim = md->GetMeshPointer()->ndim;
     using TE = parthenon::TopologicalElement;
@@ -175,6 +233,7 @@ class PoissonEquation {
 
     auto pkg = md->GetMeshPointer()->packages.Get("poisson_package");
     const auto alpha = pkg->Param<Real>("diagonal_alpha");
+    const auto beta = pkg->Param<Real>("nonlinear_beta");
 
     int nblocks = md->NumBlocks();
     std::vector<bool> include_block(nblocks, true);
@@ -185,9 +244,16 @@ class PoissonEquation {
     parthenon::par_for(
         "FluxMultiplyMatrix", 0, pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s,
         ib.e, KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
+          if (region != OperatorRegion::all) {
+            bool boundary = (i == ib.s) || (i == ib.e);
+            if (ndim > 1) boundary = boundary || (j == jb.s) || (j == jb.e);
+            if (ndim > 2) boundary = boundary || (k == kb.s) || (k == kb.e);
+            if (boundary != (region == OperatorRegion::boundary)) return;
+          }
           const auto &coords = pack.GetCoordinates(b);
           Real dx1 = coords.template Dxc<X1DIR>(k, j, i);
-          pack(b, te, out_t(), k, j, i) = -alpha * pack(b, te, in_t(), k, j, i);
+          const Real x = pack(b, te, in_t(), k, j, i);
+          pack(b, te, out_t(), k, j, i) = -alpha * x - beta * x * x * x;
           pack(b, te, out_t(), k, j, i) += (pack.flux(b, X1DIR, in_t(), k, j, i) -
                                             pack.flux(b, X1DIR, in_t(), k, j, i + 1)) /
                                            dx1;
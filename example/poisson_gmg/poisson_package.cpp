@@ -82,6 +82,10 @@ std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin) {
   Real diagonal_alpha = pin->GetOrAddReal("poisson", "diagonal_alpha", 0.0);
   pkg->AddParam<>("diagonal_alpha", diagonal_alpha);
 
+  // Coefficient of the nonlinear term -beta u^3 in the operator
+  Real nonlinear_beta = pin->GetOrAddReal("poisson", "nonlinear_beta", 0.0);
+  pkg->AddParam<>("nonlinear_beta", nonlinear_beta);
+
   std::string solver = pin->GetOrAddString("poisson", "solver", "MG");
   pkg->AddParam<>("solver", solver);
 
@@ -98,6 +102,9 @@ std::shared_ptr<StateDescriptor> Initialize(ParameterInput *pin) {
   eq.do_flux_cor = flux_correct;
 
   parthenon::solvers::MGParams mg_params(pin, "poisson/solver_params");
+  PARTHENON_REQUIRE_THROWS(nonlinear_beta == 0.0 ||
+                               (solver == "MG" && mg_params.nonlinear),
+                           "A nonlinear operator requires the nonlinear MG solver.");
   parthenon::solvers::MGSolver<u, rhs, PoissonEquation> mg_solver(pkg.get(), mg_params,
                                                                   eq);
   pkg->AddParam<>("MGsolver", mg_solver, parthenon::Params::Mutability::Mutable);
@@ -501,6 +501,25 @@ class phdf:
             print(f"Block id: {ib} with bounds {myibBounds} not found in {other.file}")
         return None  # block index not found
 
+    def ExpandCompactSparse(self, variable, data):
+        """Expands the data of a sparse variable written with compact_sparse, which
+        only contains the blocks the variable is allocated on, to all blocks.
+        Blocks on which the variable is not allocated are filled with zeros.
+        Data of any other variable is returned unchanged.
+        """
+        if "SparseInfo" not in self.fid:
+            return data
+        sparse_info = self.fid["SparseInfo"]
+        if sparse_info.attrs.get("CompactSparse", 0) == 0:
+            return data
+        fields = list(np.array(sparse_info.attrs["SparseFields"]).astype(str))
+        if variable not in fields:
+            return data
+        allocated = np.array(sparse_info[:, fields.index(variable)], dtype=bool)
+        full = np.zeros((self.NumBlocks,) + data.shape[1:], dtype=data.dtype)
+        full[allocated] = data
+        return full
+
     def Get(self, variable, flatten=True, interior=False, average_to_cell_centers=True):
         """Reads data for the named variable from file.
 
@@ -526,7 +545,9 @@ class phdf:
         """
         try:
             if self.varData.get(variable) is None:
-                self.varData[variable] = self.fid[variable][:]
+                self.varData[variable] = self.ExpandCompactSparse(
+                    variable, self.fid[variable][:]
+                )
                 vShape = self.varData[variable].shape
                 if self.OutputFormatVersion < 3:
                     raise ValueError("Unsupported output version")
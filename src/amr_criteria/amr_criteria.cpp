@@ -88,9 +88,9 @@ AmrTag AMRFirstDerivative::operator()(const MeshBlockData<Real> *rc) const {
     return AmrTag::same;
   }
   auto bnds = GetBounds(rc);
-  auto q = Kokkos::subview(rc->Get(field).data, comp6, comp5, comp4, Kokkos::ALL(),
-                           Kokkos::ALL(), Kokkos::ALL());
-  return Refinement::FirstDerivative(bnds, q, refine_criteria, derefine_criteria);
+  auto q = rc->Get(field).GetComponent(comp6, comp5, comp4);
+  return Refinement::FirstDerivative(bnds, q, refine_criteria, derefine_criteria,
+                                     q.i_stride, q.i_offset);
 }
 
 AmrTag AMRSecondDerivative::operator()(const MeshBlockData<Real> *rc) const {
@@ -98,9 +98,9 @@ AmrTag AMRSecondDerivative::operator()(const MeshBlockData<Real> *rc) const {
     return AmrTag::same;
   }
   auto bnds = GetBounds(rc);
-  auto q = Kokkos::subview(rc->Get(field).data, comp6, comp5, comp4, Kokkos::ALL(),
-                           Kokkos::ALL(), Kokkos::ALL());
-  return Refinement::SecondDerivative(bnds, q, refine_criteria, derefine_criteria);
+  auto q = rc->Get(field).GetComponent(comp6, comp5, comp4);
+  return Refinement::SecondDerivative(bnds, q, refine_criteria, derefine_criteria,
+                                      q.i_stride, q.i_offset);
 }
 
 } // namespace parthenon
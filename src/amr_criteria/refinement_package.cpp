@@ -89,8 +89,9 @@ AmrTag CheckAllRefinement(MeshBlockData<Real> *rc) {
   return delta_level;
 }
 
-AmrTag FirstDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
-                       const Real refine_criteria, const Real derefine_criteria) {
+AmrTag FirstDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q_in,
+                       const Real refine_criteria, const Real derefine_criteria,
+                       const int i_stride, const int i_offset) {
   PARTHENON_INSTRUMENT
   const int ndim = 1 + (bnds.je > bnds.js) + (bnds.ke > bnds.ks);
   Real maxd = 0.0;
@@ -98,6 +99,9 @@ AmrTag FirstDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
       loop_pattern_mdrange_tag, PARTHENON_AUTO_LABEL, DevExecSpace(), bnds.ks, bnds.ke,
       bnds.js, bnds.je, bnds.is, bnds.ie,
       KOKKOS_LAMBDA(int k, int j, int i, Real &maxd) {
+        auto q = [&](const int kk, const int jj, const int ii) {
+          return q_in(kk, jj, i_stride * ii + i_offset);
+        };
         Real scale = std::abs(q(k, j, i));
         Real d =
             0.5 * std::abs((q(k, j, i + 1) - q(k, j, i - 1))) / (scale + TINY_NUMBER);
@@ -118,8 +122,9 @@ AmrTag FirstDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
   return AmrTag::same;
 }
 
-AmrTag SecondDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
-                        const Real refine_criteria, const Real derefine_criteria) {
+AmrTag SecondDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q_in,
+                        const Real refine_criteria, const Real derefine_criteria,
+                        const int i_stride, const int i_offset) {
   PARTHENON_INSTRUMENT
   const int ndim = 1 + (bnds.je > bnds.js) + (bnds.ke > bnds.ks);
   Real maxd = 0.0;
@@ -127,6 +132,9 @@ AmrTag SecondDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
       loop_pattern_mdrange_tag, PARTHENON_AUTO_LABEL, DevExecSpace(), bnds.ks, bnds.ke,
       bnds.js, bnds.je, bnds.is, bnds.ie,
       KOKKOS_LAMBDA(int k, int j, int i, Real &maxd) {
+        auto q = [&](const int kk, const int jj, const int ii) {
+          return q_in(kk, jj, i_stride * ii + i_offset);
+        };
         Real aqt = std::abs(q(k, j, i)) + TINY_NUMBER;
         Real qavg = 0.5 * (q(k, j, i + 1) + q(k, j, i - 1));
         Real d = std::abs(qavg - q(k, j, i)) / (std::abs(qavg) + aqt);
@@ -39,11 +39,14 @@ TaskStatus Tag(T *rc);
 
 AmrTag CheckAllRefinement(MeshBlockData<Real> *rc);
 
+// Cell i of q is at q(k, j, i_stride * i + i_offset), see Metadata::ComponentInnermost
 AmrTag FirstDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
-                       const Real refine_criteria, const Real derefine_criteria);
+                       const Real refine_criteria, const Real derefine_criteria,
+                       const int i_stride = 1, const int i_offset = 0);
 
 AmrTag SecondDerivative(const AMRBounds &bnds, const ParArray3D<Real> &q,
-                        const Real refine_criteria, const Real derefine_criteria);
+                        const Real refine_criteria, const Real derefine_criteria,
+                        const int i_stride = 1, const int i_offset = 0);
 
 } // namespace Refinement
 
@@ -18,7 +18,10 @@
 #include "bvals/boundary_conditions_generic.hpp"
 #include "bvals/neighbor_block.hpp"
 #include "defs.hpp"
+#include "interface/make_swarm_pack_descriptor.hpp"
 #include "interface/meshblock_data.hpp"
+#include "interface/swarm_default_names.hpp"
+#include "kokkos_abstraction.hpp"
 #include "mesh/domain.hpp"
 #include "mesh/mesh.hpp"
 #include "mesh/mesh_refinement.hpp"
@@ -80,12 +83,108 @@ TaskStatus ApplySwarmBoundaryConditions(std::shared_ptr<Swarm> &swarm) {
   return TaskStatus::complete;
 }
 
+TaskStatus ApplySwarmBoundaryConditionsMD(std::shared_ptr<MeshData<Real>> &pmd) {
+  PARTHENON_INSTRUMENT
+  using namespace boundary_cond_impl;
+  using BoundaryFunction::BCType;
+  const int nblocks = pmd->NumBlocks();
+  if (nblocks == 0) return TaskStatus::complete;
+  Mesh *pmesh = pmd->GetMeshPointer();
+  const int ndim = pmesh->ndim;
+
+  // Built-in outflow and periodic conditions are applied to the particles of all blocks
+  // in a single kernel per swarm, so record which condition each block needs on each
+  // face (-1 for none)
+  ParArray2D<int> bc_types("swarm boundary types", nblocks, BOUNDARY_NFACES);
+  auto bc_types_h = Kokkos::create_mirror_view(bc_types);
+  bool any_user_bcs = false;
+  for (int b = 0; b < nblocks; ++b) {
+    auto pmb = pmd->GetBlockData(b)->GetBlockPointer();
+    const auto &tree_bnd_func_user =
+        pmesh->forest.GetTreePtr(pmb->loc.tree())->UserSwarmBoundaryFunctions;
+    for (int i = 0; i < BOUNDARY_NFACES; i++) {
+      bc_types_h(b, i) = -1;
+      const auto flag = pmb->boundary_flag[i];
+      if (!DoPhysicalSwarmBoundary_(flag, static_cast<BoundaryFace>(i), ndim)) continue;
+      if (flag == BoundaryFlag::outflow) {
+        bc_types_h(b, i) = static_cast<int>(BCType::Outflow);
+      } else if (flag == BoundaryFlag::periodic) {
+        bc_types_h(b, i) = static_cast<int>(BCType::Periodic);
+      } else {
+        any_user_bcs = true;
+      }
+      any_user_bcs = any_user_bcs || (tree_bnd_func_user[i].size() > 0);
+    }
+  }
+  Kokkos::deep_copy(pmd->exec_space, bc_types, bc_types_h);
+
+  for (auto &swarm : pmd->GetSwarmData(0)->GetSwarmVector()) {
+    auto desc =
+        MakeSwarmPackDescriptor<swarm_position::x, swarm_position::y, swarm_position::z>(
+            swarm->label());
+    auto pack = desc.GetPack(pmd.get());
+    parthenon::par_for(
+        DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, pmd->exec_space, 0,
+        pack.GetMaxFlatIndex(), KOKKOS_LAMBDA(const int idx) {
+          auto [b, n] = pack.GetBlockParticleIndices(idx);
+          const auto &swarm_d = pack.GetContext(b);
+          if (swarm_d.IsActive(n)) {
+            Real &x = pack(b, swarm_position::x(), n);
+            Real &y = pack(b, swarm_position::y(), n);
+            Real &z = pack(b, swarm_position::z(), n);
+            for (int iface = 0; iface < BOUNDARY_NFACES; ++iface) {
+              const int type = bc_types(b, iface);
+              if (type == static_cast<int>(BCType::Outflow)) {
+                BoundaryFunction::SwarmBC<BCType::Outflow>(iface, swarm_d, n, x, y, z);
+              } else if (type == static_cast<int>(BCType::Periodic)) {
+                BoundaryFunction::SwarmBC<BCType::Periodic>(iface, swarm_d, n, x, y, z);
+              }
+            }
+          }
+        });
+  }
+
+  // User conditions are arbitrary host functions, so they are still applied block by
+  // block, after all of the built-in conditions
+  if (any_user_bcs) {
+    for (int b = 0; b < nblocks; ++b) {
+      auto pmb = pmd->GetBlockData(b)->GetBlockPointer();
+      auto &tree_bnd_func = pmesh->forest.GetTreePtr(pmb->loc.tree())->SwarmBndryFnctn;
+      auto &tree_bnd_func_user =
+          pmesh->forest.GetTreePtr(pmb->loc.tree())->UserSwarmBoundaryFunctions;
+      for (auto &swarm : pmd->GetSwarmData(b)->allSwarms()) {
+        for (int i = 0; i < BOUNDARY_NFACES; i++) {
+          const auto flag = pmb->boundary_flag[i];
+          if (!DoPhysicalSwarmBoundary_(flag, static_cast<BoundaryFace>(i), ndim))
+            continue;
+          if (flag != BoundaryFlag::outflow && flag != BoundaryFlag::periodic)
+            tree_bnd_func[i](swarm);
+          for (auto &bnd_func : tree_bnd_func_user[i]) {
+            bnd_func(swarm);
+          }
+        }
+      }
+    }
+  }
+  return TaskStatus::complete;
+}
+
 TaskStatus ApplyBoundaryConditionsMD(std::shared_ptr<MeshData<Real>> &pmd) {
   for (int b = 0; b < pmd->NumBlocks(); ++b)
     ApplyBoundaryConditions(pmd->GetBlockData(b));
   return TaskStatus::complete;
 }
 
+bool HasPhysicalBoundary(const MeshBlock *pmb) {
+  using namespace boundary_cond_impl;
+  const int ndim = pmb->pmy_mesh->ndim;
+  for (int i = 0; i < BOUNDARY_NFACES; i++) {
+    if (DoPhysicalBoundary_(pmb->boundary_flag[i], static_cast<BoundaryFace>(i), ndim))
+      return true;
+  }
+  return false;
+}
+
 TaskStatus ApplyBoundaryConditionsOnCoarseOrFineMD(std::shared_ptr<MeshData<Real>> &pmd,
                                                    bool coarse) {
   for (int b = 0; b < pmd->NumBlocks(); ++b)
@@ -42,6 +42,9 @@ TaskStatus ApplyBoundaryConditionsMD(std::shared_ptr<MeshData<Real>> &pmd);
 TaskStatus ApplyBoundaryConditionsOnCoarseOrFineMD(std::shared_ptr<MeshData<Real>> &pmd,
                                                    bool coarse);
 
+// Whether boundary conditions are applied on any face of the block
+bool HasPhysicalBoundary(const MeshBlock *pmb);
+
 TaskStatus ApplySwarmBoundaryConditionsMD(std::shared_ptr<MeshData<Real>> &pmd);
 
 TaskStatus ApplySwarmBoundaryConditions(std::shared_ptr<Swarm> &swarm);
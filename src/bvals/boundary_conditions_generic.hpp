@@ -38,101 +38,87 @@ namespace BoundaryFunction {
 enum class BCSide { Inner, Outer };
 enum class BCType { Outflow, Reflect, ConstantDeriv, Fixed, FixedFace, Periodic };
 
-// TODO(BRR) add support for specific swarms?
+// Apply a single swarm boundary condition to particle n, with x, y, and z its position
 template <CoordinateDirection DIR, BCSide SIDE, BCType TYPE>
-void GenericSwarmBC(std::shared_ptr<Swarm> &swarm) {
+KOKKOS_INLINE_FUNCTION void SwarmBC(const SwarmDeviceContext &swarm_d, const int n,
+                                    Real &x, Real &y, Real &z) {
   // make sure DIR is X[123]DIR so we don't have to check again
   static_assert(DIR == X1DIR || DIR == X2DIR || DIR == X3DIR, "DIR must be X[123]DIR");
+  constexpr bool INNER = (SIDE == BCSide::Inner);
+  Real &pos = DIR == X1DIR ? x : (DIR == X2DIR ? y : z);
+  const Real &pos_min = DIR == X1DIR ? swarm_d.x_min_global_
+                                     : (DIR == X2DIR ? swarm_d.y_min_global_
+                                                     : swarm_d.z_min_global_);
+  const Real &pos_max = DIR == X1DIR ? swarm_d.x_max_global_
+                                     : (DIR == X2DIR ? swarm_d.y_max_global_
+                                                     : swarm_d.z_max_global_);
+  if constexpr (INNER) {
+    if constexpr (TYPE == BCType::Periodic) {
+      if (pos > pos_max) {
+        pos = pos_min + (pos - pos_max);
+      }
+    } else if constexpr (TYPE == BCType::Outflow) {
+      if (pos < pos_min) {
+        swarm_d.MarkParticleForRemoval(n);
+      }
+    }
+  } else {
+    if constexpr (TYPE == BCType::Periodic) {
+      if (pos < pos_min) {
+        pos = pos_max - (pos_min - pos);
+      }
+    } else if constexpr (TYPE == BCType::Outflow) {
+      if (pos > pos_max) {
+        swarm_d.MarkParticleForRemoval(n);
+      }
+    }
+  }
+}
 
-  auto swarm_d_ = swarm->GetDeviceContext();
+// Apply the swarm boundary condition of type TYPE on face iface to particle n
+template <BCType TYPE>
+KOKKOS_INLINE_FUNCTION void SwarmBC(const int iface, const SwarmDeviceContext &swarm_d,
+                                    const int n, Real &x, Real &y, Real &z) {
+  switch (static_cast<BoundaryFace>(iface)) {
+  case BoundaryFace::inner_x1:
+    SwarmBC<X1DIR, BCSide::Inner, TYPE>(swarm_d, n, x, y, z);
+    break;
+  case BoundaryFace::outer_x1:
+    SwarmBC<X1DIR, BCSide::Outer, TYPE>(swarm_d, n, x, y, z);
+    break;
+  case BoundaryFace::inner_x2:
+    SwarmBC<X2DIR, BCSide::Inner, TYPE>(swarm_d, n, x, y, z);
+    break;
+  case BoundaryFace::outer_x2:
+    SwarmBC<X2DIR, BCSide::Outer, TYPE>(swarm_d, n, x, y, z);
+    break;
+  case BoundaryFace::inner_x3:
+    SwarmBC<X3DIR, BCSide::Inner, TYPE>(swarm_d, n, x, y, z);
+    break;
+  case BoundaryFace::outer_x3:
+    SwarmBC<X3DIR, BCSide::Outer, TYPE>(swarm_d, n, x, y, z);
+    break;
+  default:
+    break;
+  }
+}
+
+// TODO(BRR) add support for specific swarms?
+template <CoordinateDirection DIR, BCSide SIDE, BCType TYPE>
+void GenericSwarmBC(std::shared_ptr<Swarm> &swarm) {
+  auto swarm_d = swarm->GetDeviceContext();
   int max_active_index = swarm->GetMaxActiveIndex();
 
   auto pmb = swarm->GetBlockPointer();
 
-  auto &x_ = swarm->Get<Real>(swarm_position::x::name()).Get();
-  auto &y_ = swarm->Get<Real>(swarm_position::y::name()).Get();
-  auto &z_ = swarm->Get<Real>(swarm_position::z::name()).Get();
+  auto &x = swarm->Get<Real>(swarm_position::x::name()).Get();
+  auto &y = swarm->Get<Real>(swarm_position::y::name()).Get();
+  auto &z = swarm->Get<Real>(swarm_position::z::name()).Get();
 
   pmb->par_for(
       PARTHENON_AUTO_LABEL, 0, max_active_index, KOKKOS_LAMBDA(const int n) {
-        // convenient shorthands
-        [[maybe_unused]] constexpr bool X1 = (DIR == X1DIR);
-        [[maybe_unused]] constexpr bool X2 = (DIR == X2DIR);
-        [[maybe_unused]] constexpr bool X3 = (DIR == X3DIR);
-        // Cannot capture variables inside constexpr if context
-        [[maybe_unused]] const auto &x = x_;
-        [[maybe_unused]] const auto &y = y_;
-        [[maybe_unused]] const auto &z = z_;
-        const auto &swarm_d = swarm_d_;
-        constexpr bool INNER = (SIDE == BCSide::Inner);
         if (swarm_d.IsActive(n)) {
-          if constexpr (X1) {
-            if constexpr (INNER) {
-              if constexpr (TYPE == BCType::Periodic) {
-                if (x(n) > swarm_d.x_max_global_) {
-                  x(n) = swarm_d.x_min_global_ + (x(n) - swarm_d.x_max_global_);
-                }
-              } else if constexpr (TYPE == BCType::Outflow) {
-                if (x(n) < swarm_d.x_min_global_) {
-                  swarm_d.MarkParticleForRemoval(n);
-                }
-              }
-            } else {
-              if constexpr (TYPE == BCType::Periodic) {
-                if (x(n) < swarm_d.x_min_global_) {
-                  x(n) = swarm_d.x_max_global_ - (swarm_d.x_min_global_ - x(n));
-                }
-              } else if constexpr (TYPE == BCType::Outflow) {
-                if (x(n) > swarm_d.x_max_global_) {
-                  swarm_d.MarkParticleForRemoval(n);
-                }
-              }
-            }
-          } else if constexpr (X2) {
-            if constexpr (INNER) {
-              if constexpr (TYPE == BCType::Periodic) {
-                if (y(n) > swarm_d.y_max_global_) {
-                  y(n) = swarm_d.y_min_global_ + (y(n) - swarm_d.y_max_global_);
-                }
-              } else if constexpr (TYPE == BCType::Outflow) {
-                if (y(n) < swarm_d.y_min_global_) {
-                  swarm_d.MarkParticleForRemoval(n);
-                }
-              }
-            } else {
-              if constexpr (TYPE == BCType::Periodic) {
-                if (y(n) < swarm_d.y_min_global_) {
-                  y(n) = swarm_d.y_max_global_ - (swarm_d.y_min_global_ - y(n));
-                }
-              } else if constexpr (TYPE == BCType::Outflow) {
-                if (y(n) > swarm_d.y_max_global_) {
-                  swarm_d.MarkParticleForRemoval(n);
-                }
-              }
-            }
-          } else if constexpr (X3) {
-            if constexpr (INNER) {
-              if constexpr (TYPE == BCType::Periodic) {
-                if (z(n) > swarm_d.z_max_global_) {
-                  z(n) = swarm_d.z_min_global_ + (z(n) - swarm_d.z_max_global_);
-                }
-              } else if constexpr (TYPE == BCType::Outflow) {
-                if (z(n) < swarm_d.z_min_global_) {
-                  swarm_d.MarkParticleForRemoval(n);
-                }
-              }
-            } else {
-              if constexpr (TYPE == BCType::Periodic) {
-                if (z(n) < swarm_d.z_min_global_) {
-                  z(n) = swarm_d.z_max_global_ - (swarm_d.z_min_global_ - z(n));
-                }
-              } else if constexpr (TYPE == BCType::Outflow) {
-                if (z(n) > swarm_d.z_max_global_) {
-                  swarm_d.MarkParticleForRemoval(n);
-                }
-              }
-            }
-          }
+          SwarmBC<DIR, SIDE, TYPE>(swarm_d, n, x(n), y(n), z(n));
         }
       });
 }
@@ -16,6 +16,7 @@
 //========================================================================================
 
 #include <algorithm>
+#include <array>
 #include <iostream> // debug
 #include <memory>
 #include <string>
@@ -38,7 +39,9 @@
 
 namespace parthenon {
 
-void ProResCache_t::Initialize(int n_regions, StateDescriptor *pkg) {
+void ProResCache_t::Initialize(int n_regions, StateDescriptor *pkg,
+                               DevExecSpace exec_space_in) {
+  exec_space = exec_space_in;
   prores_info = ParArray1D<ProResInfo>("prores_info", n_regions);
   prores_info_h = Kokkos::create_mirror_view(prores_info);
   int nref_funcs = pkg->NumRefinementFuncs();
@@ -49,6 +52,13 @@ void ProResCache_t::Initialize(int n_regions, StateDescriptor *pkg) {
   buffer_subset_sizes.resize(nref_funcs, 0);
   buffer_subsets = ParArray2D<std::size_t>("buffer_subsets", nref_funcs, n_regions);
   buffer_subsets_h = Kokkos::create_mirror_view(buffer_subsets);
+  group_subset_sizes.clear();
+  group_subset_sizes.resize(nref_funcs, 0);
+  group_starts = ParArray2D<std::size_t>("group_starts", nref_funcs, n_regions + 1);
+  group_starts_h = Kokkos::create_mirror_view(group_starts);
+  group_vars.clear();
+  group_vars.resize(nref_funcs, nullptr);
+  all_regions_in_subsets = true;
 }
 
 void ProResCache_t::RegisterRegionHost(int region, ProResInfo pri, Variable<Real> *v,
@@ -61,7 +71,13 @@ void ProResCache_t::RegisterRegionHost(int region, ProResInfo pri, Variable<Real
     // `RefinementOp_t` in `BndInfo` is assumed to
     // differentiate.
     std::size_t rfid = pkg->RefinementFuncID((v->GetRefinementFunctions()));
+    if (group_vars[rfid] != v) {
+      group_vars[rfid] = v;
+      group_starts_h(rfid, group_subset_sizes[rfid]++) = buffer_subset_sizes[rfid];
+    }
     buffer_subsets_h(rfid, buffer_subset_sizes[rfid]++) = region;
+  } else {
+    all_regions_in_subsets = false;
   }
 }
 
@@ -101,6 +117,84 @@ GetFluxCorrectionElements(const std::shared_ptr<Variable<Real>> &v,
   return elements;
 }
 
+// Drop boundary planes of the index range [s, e] that contain no elements owned by the
+// sending block, so that they are neither packed, communicated, nor unpacked. The mask is
+// remapped onto the compacted range, and elements in planes that are only partially
+// unowned (e.g. the edges of a face) are still excluded through the mask.
+void CompactIndexRange(block_ownership_t *owns, std::array<int, 3> *s,
+                       std::array<int, 3> *e) {
+  // Mask indices that actually occur in a range along each direction
+  auto mask_idxs = [](int start, int end) -> std::vector<int> {
+    if (start == end) return {0};
+    if (end == start + 1) return {-1, 1};
+    return {-1, 0, 1};
+  };
+  std::array<std::vector<int>, 3> idxs{mask_idxs((*s)[0], (*e)[0]),
+                                       mask_idxs((*s)[1], (*e)[1]),
+                                       mask_idxs((*s)[2], (*e)[2])};
+  auto plane_owned = [&](int dir, int side) {
+    const int d1 = (dir + 1) % 3;
+    const int d2 = (dir + 2) % 3;
+    for (int a : idxs[d1]) {
+      for (int b : idxs[d2]) {
+        std::array<int, 3> ox;
+        ox[dir] = side;
+        ox[d1] = a;
+        ox[d2] = b;
+        if ((*owns)(ox[0], ox[1], ox[2])) return true;
+      }
+    }
+    return false;
+  };
+
+  std::array<int, 3> ns = *s;
+  std::array<int, 3> ne = *e;
+  for (int dir = 0; dir < 3; ++dir) {
+    if (ne[dir] > ns[dir] && !plane_owned(dir, -1)) ns[dir]++;
+    if (ne[dir] > ns[dir] && !plane_owned(dir, 1)) ne[dir]--;
+  }
+  if (ns == *s && ne == *e) return;
+
+  // Map the mask indices of the compacted range back to those of the original range
+  std::array<std::array<int, 3>, 3> old_idx;
+  for (int dir = 0; dir < 3; ++dir) {
+    auto old_mask_idx = [&](int x) { return (x == (*e)[dir]) - (x == (*s)[dir]); };
+    if (ns[dir] == ne[dir]) {
+      old_idx[dir] = {0, old_mask_idx(ns[dir]), 0};
+    } else {
+      old_idx[dir] = {old_mask_idx(ns[dir]), 0, old_mask_idx(ne[dir])};
+    }
+  }
+  block_ownership_t compacted = *owns;
+  for (int i : {-1, 0, 1}) {
+    for (int j : {-1, 0, 1}) {
+      for (int k : {-1, 0, 1}) {
+        compacted(i, j, k) =
+            (*owns)(old_idx[0][i + 1], old_idx[1][j + 1], old_idx[2][k + 1]);
+      }
+    }
+  }
+  *owns = compacted;
+  *s = ns;
+  *e = ne;
+}
+
+bool IsIdentityTransformation(const forest::LogicalCoordinateTransformation &trans) {
+  for (int dir = 0; dir < 3; ++dir) {
+    if (trans.dir_connection[dir] != dir || trans.dir_flip[dir]) return false;
+  }
+  return true;
+}
+
+// Number of ghost zones of v that are communicated. On multilevel meshes this is kept
+// even, so that the coarse ghosts that are prolongated cover whole fine ghost zones.
+int GetCommunicatedGhostDepth(const MeshBlock *pmb, const Variable<Real> &v) {
+  const int depth = v.metadata().GetGhostDepth();
+  if (depth == 0) return Globals::nghost;
+  const bool multilevel = pmb->pmy_mesh->multilevel;
+  return std::min(Globals::nghost, multilevel ? depth + depth % 2 : depth);
+}
+
 SpatiallyMaskedIndexer6D
 CalcIndices(const NeighborBlock &nb, MeshBlock *pmb,
             const std::shared_ptr<Variable<Real>> &v, TopologicalElement el,
@@ -148,10 +242,9 @@ CalcIndices(const NeighborBlock &nb, MeshBlock *pmb,
                                 TopologicalOffsetK(el)};
   std::array<int, 3> block_offset = nb.offsets;
 
-  int interior_offset =
-      ir_type == IndexRangeType::BoundaryInteriorSend ? Globals::nghost : 0;
-  int exterior_offset =
-      ir_type == IndexRangeType::BoundaryExteriorRecv ? Globals::nghost : 0;
+  const int nghost = GetCommunicatedGhostDepth(pmb, *v);
+  int interior_offset = ir_type == IndexRangeType::BoundaryInteriorSend ? nghost : 0;
+  int exterior_offset = ir_type == IndexRangeType::BoundaryExteriorRecv ? nghost : 0;
   if (prores) {
     // The coarse ghosts cover twice as much volume as the fine ghosts, so when working in
     // the exterior (i.e. ghosts) we must only go over the coarse ghosts that have
@@ -244,6 +337,41 @@ CalcIndices(const NeighborBlock &nb, MeshBlock *pmb,
       if (sox3 == 0) sox3 = loc.l(2) % 2 == 1 ? 1 : -1;
     }
     owns = GetIndexRangeMaskFromOwnership(el, nb.ownership, sox1, sox2, sox3);
+    // Ranges that are only used for prolongation are not tied to a buffer, but buffer
+    // ranges have to be compacted in the same way by the sender
+    if (prores || IsIdentityTransformation(nb.lcoord_trans))
+      CompactIndexRange(&owns, &s, &e);
+  } else if (ir_type == IndexRangeType::BoundaryInteriorSend && !prores &&
+             IsIdentityTransformation(nb.lcoord_trans)) {
+    // Build the mask the receiving block will use for this range from our own
+    // ownership, so that the sent range is compacted exactly like the received one.
+    // The mask itself is not needed on the sending side.
+    int sox1 = block_offset[0];
+    int sox2 = block_offset[1];
+    int sox3 = block_offset[2];
+    if (nb.origin_loc.level() > loc.level()) {
+      if (sox1 == 0) sox1 = nb.origin_loc.l(0) % 2 == 1 ? 1 : -1;
+      if (sox2 == 0) sox2 = nb.origin_loc.l(1) % 2 == 1 ? 1 : -1;
+      if (sox3 == 0) sox3 = nb.origin_loc.l(2) % 2 == 1 ? 1 : -1;
+    }
+    auto recv_owns =
+        GetIndexRangeMaskFromOwnership(el, nb.origin_ownership, sox1, sox2, sox3);
+    CompactIndexRange(&recv_owns, &s, &e);
+  }
+  if (v->IsSet(Metadata::ComponentInnermost) && !prores) {
+    // The components of each cell are contiguous, so they are fused with x1 and each row
+    // of the boundary is contiguous in data. This requires that no element is masked
+    // out and that the neighbor is not rotated or reflected.
+    const SpatiallyMaskedIndexer6D idxer(owns, {0, 0}, {0, 0}, {0, 0}, {s[2], e[2]},
+                                         {s[1], e[1]}, {s[0], e[0]});
+    PARTHENON_REQUIRE_THROWS(IsIdentityTransformation(nb.lcoord_trans) &&
+                                 idxer.AllActive(),
+                             "Variables with their components innermost can only be "
+                             "communicated on meshes made of a single tree");
+    const int ncomp = v->NumComponents();
+    return SpatiallyMaskedIndexer6D(block_ownership_t(true), {0, 0}, {0, 0}, {0, 0},
+                                    {s[2], e[2]}, {s[1], e[1]},
+                                    {s[0] * ncomp, e[0] * ncomp + ncomp - 1});
   }
   return SpatiallyMaskedIndexer6D(owns, {0, tensor_shape[0] - 1},
                                   {0, tensor_shape[1] - 1}, {0, tensor_shape[2] - 1},
@@ -251,22 +379,80 @@ CalcIndices(const NeighborBlock &nb, MeshBlock *pmb,
 }
 
 int GetBufferSize(MeshBlock *pmb, const NeighborBlock &nb,
-                  std::shared_ptr<Variable<Real>> v) {
-  // This does not do a careful job of calculating the buffer size, in many
-  // cases there will be some extra storage that is not required, but there
-  // will always be enough storage
-  auto &cb = v->IsSet(Metadata::Fine) ? pmb->f_cellbounds : pmb->cellbounds;
-  int topo_comp = (v->IsSet(Metadata::Face) || v->IsSet(Metadata::Edge)) ? 3 : 1;
-  const IndexDomain in = IndexDomain::entire;
-  // The plus 2 instead of 1 is to account for the possible size of face, edge, and nodal
-  // fields
-  const int isize = cb.ie(in) - cb.is(in) + 2;
-  const int jsize = cb.je(in) - cb.js(in) + 2;
-  const int ksize = cb.ke(in) - cb.ks(in) + 2;
-  return (nb.offsets(X1DIR) == 0 ? isize : Globals::nghost + 1) *
-         (nb.offsets(X2DIR) == 0 ? jsize : Globals::nghost + 1) *
-         (nb.offsets(X3DIR) == 0 ? ksize : Globals::nghost + 1) * v->GetDim(6) *
-         v->GetDim(5) * v->GetDim(4) * topo_comp;
+                  std::shared_ptr<Variable<Real>> v, bool sender) {
+  if (pmb->gid == nb.gid && nb.offsets.IsCell()) return 0;
+  // Count the elements of the index ranges that are actually packed or unpacked, so that
+  // planes dropped by CompactIndexRange are not allocated or communicated. Sender and
+  // receiver compact their ranges identically, so they agree on the size.
+  IndexRangeType ir_type;
+  if (sender) {
+    ir_type = nb.offsets.IsCell() ? IndexRangeType::InteriorSend
+                                  : IndexRangeType::BoundaryInteriorSend;
+  } else {
+    ir_type = nb.offsets.IsCell() ? IndexRangeType::InteriorRecv
+                                  : IndexRangeType::BoundaryExteriorRecv;
+  }
+  auto elements = v->GetTopologicalElements();
+  if (v->IsSet(Metadata::Flux)) elements = GetFluxCorrectionElements(v, nb.offsets);
+  int size = 0;
+  for (auto el : elements) {
+    if (ir_type == IndexRangeType::BoundaryExteriorRecv)
+      el = std::get<0>(nb.lcoord_trans.InverseTransform(el));
+    // The extent of an index range does not depend on lcoord_trans.ncell
+    size += CalcIndices(nb, pmb, v, el, ir_type, false, nb.lcoord_trans).size();
+  }
+  return size;
+}
+
+bool NeedsFluxCorrection(const NeighborBlock &nb, const Variable<Real> &v) {
+  if (nb.offsets.IsFace() && v.IsSet(Metadata::Face)) return true;
+  if ((nb.offsets.IsFace() || nb.offsets.IsEdge()) && v.IsSet(Metadata::Edge))
+    return true;
+  if ((nb.offsets.IsFace() || nb.offsets.IsEdge() || nb.offsets.IsNode()) &&
+      v.IsSet(Metadata::Node))
+    return true;
+  return false;
+}
+
+bool UseCombinedFluxCorrection(const MeshBlock *pmb, const Variable<Real> &v) {
+  // Sparse variables keep their own messages, since whether data is sent for them
+  // depends on their allocation status
+  return pmb->pmy_mesh->CombineFluxCorrections() && v.IsSet(Metadata::Flux) &&
+         !v.IsSet(Metadata::Sparse);
+}
+
+std::vector<BndChunk> GetBndChunks(const BndInfoArrHost_t &bnd_info_h) {
+  const int nbound = bnd_info_h.extent_int(0);
+  int total_size = 0;
+  for (int b = 0; b < nbound; ++b) {
+    for (int it = 0; it < bnd_info_h(b).ntopological_elements; ++it)
+      total_size += bnd_info_h(b).idxer[it].size();
+  }
+  // Boundaries up to the average size are handled by a single team, larger ones are
+  // split so that no team has much more work than the average. The budget is in
+  // elements rather than rows, since rows of different boundaries (e.g. x1 faces and x2
+  // faces) can differ in length by up to the block size.
+  const int size_per_chunk =
+      nbound > 0 ? std::max(1, (total_size + nbound - 1) / nbound) : 1;
+
+  std::vector<BndChunk> chunks;
+  for (int b = 0; b < nbound; ++b) {
+    int buf_offset = 0;
+    for (int it = 0; it < bnd_info_h(b).ntopological_elements; ++it) {
+      const int size = bnd_info_h(b).idxer[it].size();
+      const int nrows = bnd_info_h(b).NumRows(it);
+      if (nrows > 0) {
+        const int row_size = size / nrows;
+        const int rows_per_chunk = std::max(1, size_per_chunk / row_size);
+        for (int row_s = 0; row_s < nrows; row_s += rows_per_chunk) {
+          chunks.push_back({b, it, row_s, std::min(row_s + rows_per_chunk, nrows),
+                            buf_offset});
+        }
+      }
+      buf_offset += size;
+    }
+  }
+  return chunks;
 }
 
 BndInfo::BndInfo(MeshBlock *pmb, const NeighborBlock &nb,
@@ -300,6 +486,7 @@ BndInfo::BndInfo(MeshBlock *pmb, const NeighborBlock &nb,
     if (idx_range_type == IndexRangeType::BoundaryExteriorRecv)
       el = std::get<0>(lcoord_trans.InverseTransform(el));
     idxer[idx] = CalcIndices(nb, pmb, v, el, idx_range_type, false, lcoord_trans);
+    plain_copy[idx] = IsIdentityTransformation(lcoord_trans) && idxer[idx].AllActive();
     idx++;
   }
 }
@@ -349,6 +536,11 @@ ProResInfo::ProResInfo(MeshBlock *pmb, const NeighborBlock &nb,
 
   fine = v->data.Get();
   coarse = v->coarse_s.Get();
+  if (v->IsSet(Metadata::ComponentInnermost) && allocated && coarse.IsAllocated()) {
+    strided = true;
+    fine_strided = v->GetLogicalView(v->data);
+    coarse_strided = v->GetLogicalView(v->coarse_s, true);
+  }
 }
 
 ProResInfo ProResInfo::GetInteriorRestrict(MeshBlock *pmb, const NeighborBlock &nb,
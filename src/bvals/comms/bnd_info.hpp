@@ -18,14 +18,18 @@
 #ifndef BVALS_COMMS_BND_INFO_HPP_
 #define BVALS_COMMS_BND_INFO_HPP_
 
+#include <array>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "basic_types.hpp"
 #include "bvals/neighbor_block.hpp"
 #include "coordinates/coordinates.hpp"
 #include "interface/variable_state.hpp"
+#include "kokkos_abstraction.hpp"
 #include "mesh/domain.hpp"
 #include "mesh/forest/logical_coordinate_transformation.hpp"
 #include "utils/communication_buffer.hpp"
@@ -54,6 +58,10 @@ struct BndInfo {
   TE topo_idx[3]{TE::CC, TE::CC, TE::CC};
   SpatiallyMaskedIndexer6D idxer[3];
   forest::LogicalCoordinateTransformation lcoord_trans;
+  // Whether the rows of topological element it can be unpacked by a plain copy, i.e.
+  // the transformation to the neighbor is the identity and no element is masked out.
+  // This is the case for all boundaries of meshes made of a single tree.
+  bool plain_copy[3]{false, false, false};
 
   CoordinateDirection dir{CoordinateDirection::X0DIR};
   bool allocated = true;
@@ -80,8 +88,81 @@ struct BndInfo {
   static BndInfo GetSetBndInfo(MeshBlock *pmb, const NeighborBlock &nb,
                                std::shared_ptr<Variable<Real>> v,
                                CommBuffer<buf_pool_t<Real>::owner_t> *buf);
+
+  // Number of runs of contiguous indices in the fastest moving direction of topological
+  // element it
+  KOKKOS_INLINE_FUNCTION
+  int NumRows(const int it) const {
+    const int Ni = idxer[it].EndIdx<5>() - idxer[it].StartIdx<5>() + 1;
+    return Ni > 0 ? idxer[it].size() / Ni : 0;
+  }
+
+  // Unpack rows [row_s, row_e) of topological element it, which starts at buf_offset in
+  // the buffer, into var. If the buffer is unallocated but var is not, the rows are set
+  // to the sparse default value when set_default is true.
+  KOKKOS_INLINE_FUNCTION
+  void SetRows(team_mbr_t &team_member, const int it, const int row_s, const int row_e,
+               const int buf_offset, const bool set_default) const {
+    if (!allocated || (!buf_allocated && !set_default)) return;
+    if (plain_copy[it]) {
+      CopyRows(team_member, it, row_s, row_e, buf_offset);
+      return;
+    }
+    const auto &idx = idxer[it];
+    const auto &trans = lcoord_trans;
+    const auto &v = var;
+    const auto [tel, ftemp] = trans.InverseTransform(topo_idx[it]);
+    const Real fac = ftemp; // Can't capture structured bindings
+    const int iel = static_cast<int>(tel) % 3;
+    const int Ni = idx.EndIdx<5>() - idx.StartIdx<5>() + 1;
+    const bool from_buf = buf_allocated;
+    const Real default_val = var.sparse_default_val;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange<>(team_member, row_s, row_e), [&](const int row) {
+          const Real *pbuf = from_buf ? &buf(row * Ni + buf_offset) : nullptr;
+          const auto [t, u, v_, k, j, i] = idx(row * Ni);
+          // Have to do this because of some weird issue about structure bindings
+          // being captured
+          const int tt = t;
+          const int uu = u;
+          const int vv = v_;
+          const int kk = k;
+          const int jj = j;
+          const int ii = i;
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange<>(team_member, Ni), [&](int m) {
+                const auto [il, jl, kl] = trans.InverseTransform({ii + m, jj, kk});
+                if (idx.IsActive(kl, jl, il))
+                  v(iel, tt, uu, vv, kl, jl, il) = from_buf ? fac * pbuf[m] : default_val;
+              });
+        });
+  }
+
+  // Fast path of SetRows for boundaries without transformation or masking, where each
+  // row of the buffer is contiguous in var
+  KOKKOS_INLINE_FUNCTION
+  void CopyRows(team_mbr_t &team_member, const int it, const int row_s, const int row_e,
+                const int buf_offset) const {
+    const auto &idx = idxer[it];
+    const int iel = static_cast<int>(topo_idx[it]) % 3;
+    const int Ni = idx.EndIdx<5>() - idx.StartIdx<5>() + 1;
+    const bool from_buf = buf_allocated;
+    const Real default_val = var.sparse_default_val;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange<>(team_member, row_s, row_e), [&](const int row) {
+          const auto [t, u, v, k, j, i] = idx(row * Ni);
+          Real *pvar = &var(iel, t, u, v, k, j, i);
+          const Real *pbuf = from_buf ? &buf(row * Ni + buf_offset) : nullptr;
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange<>(team_member, Ni), [&](int m) {
+            pvar[m] = from_buf ? pbuf[m] : default_val;
+          });
+        });
+  }
 };
 
+// Logical (element, t, u, v, k, j, i) view of variables with Metadata::ComponentInnermost
+using StridedProResArr_t = ParArrayND<Real, VariableState, Kokkos::LayoutStride>;
+
 struct ProResInfo {
   int ntopological_elements = 1;
   // Has to be large enough to allow for maximum integer
@@ -103,6 +184,11 @@ struct ProResInfo {
   Coordinates_t coords, coarse_coords; // coords
 
   ParArrayND<Real, VariableState> fine, coarse;
+  // Refinement ops work on these instead of fine and coarse if strided is true, since
+  // the data of variables with their components innermost cannot be indexed as
+  // (element, t, u, v, k, j, i) otherwise
+  bool strided = false;
+  StridedProResArr_t fine_strided, coarse_strided;
   KOKKOS_DEFAULTED_FUNCTION
   ProResInfo() = default;
   KOKKOS_DEFAULTED_FUNCTION
@@ -124,21 +210,73 @@ struct ProResInfo {
                                         std::shared_ptr<Variable<Real>> v);
 };
 
+// Drop the boundary planes of the index range [s, e] with the range mask owns that
+// contain no elements owned by the sending block, and remap owns onto the new range
+void CompactIndexRange(block_ownership_t *owns, std::array<int, 3> *s,
+                       std::array<int, 3> *e);
+
+// Size of the buffer that pmb sends to (sender = true) or receives from nb for v
 int GetBufferSize(MeshBlock *pmb, const NeighborBlock &nb,
-                  std::shared_ptr<Variable<Real>> v);
+                  std::shared_ptr<Variable<Real>> v, bool sender);
+
+// Whether the flux variable v is corrected across the element shared with nb
+bool NeedsFluxCorrection(const NeighborBlock &nb, const Variable<Real> &v);
+
+// When flux corrections are combined, the fluxes of all dense variables on a boundary
+// are sent in one buffer, with each variable at a fixed range of the buffer
+bool UseCombinedFluxCorrection(const MeshBlock *pmb, const Variable<Real> &v);
+
+// Layout of the combined flux correction buffer of one boundary, with the range of each
+// variable in the buffer by label
+struct CombinedFluxCorrectionLayout {
+  int size = 0;
+  std::unordered_map<std::string, std::pair<int, int>> ranges;
+};
 
 using BndInfoArr_t = ParArray1D<BndInfo>;
 using BndInfoArrHost_t = typename BndInfoArr_t::HostMirror;
 
+// A range of rows [row_s, row_e) of topological element it of boundary b, where a row
+// is a run of contiguous indices in the fastest moving direction and buf_offset is the
+// position of the first index of element it in the buffer. Packing and unpacking is
+// distributed over chunks rather than over boundaries so that the work per team does
+// not depend on how large the largest buffer is.
+struct BndChunk {
+  int b;
+  int it;
+  int row_s;
+  int row_e;
+  int buf_offset;
+};
+
+using BndChunkArr_t = ParArray1D<BndChunk>;
+
+// Split the boundaries described by bnd_info_h into chunks of whole rows holding at most
+// roughly the average number of elements per boundary (or a single row, if rows are
+// longer than that)
+std::vector<BndChunk> GetBndChunks(const BndInfoArrHost_t &bnd_info_h);
+
 using ProResInfoArr_t = ParArray1D<ProResInfo>;
 using ProResInfoArrHost_t = typename ParArray1D<ProResInfo>::HostMirror;
 class StateDescriptor;
 struct ProResCache_t {
+  // Execution space instance that prolongation/restriction kernels are launched on
+  DevExecSpace exec_space{};
   ProResInfoArr_t prores_info{};
   ProResInfoArr_t::host_mirror_type prores_info_h{};
   std::vector<std::size_t> buffer_subset_sizes;
   ParArray2D<std::size_t> buffer_subsets{};
   ParArray2D<std::size_t>::host_mirror_type buffer_subsets_h{};
+  // Regions of the same variable on the same block are registered consecutively, and
+  // only depend on each other during prolongation and restriction. Group g of subset
+  // rfid contains buffer_subsets(rfid, n) for group_starts(rfid, g) <= n <
+  // group_starts(rfid, g + 1).
+  std::vector<std::size_t> group_subset_sizes;
+  ParArray2D<std::size_t> group_starts{};
+  ParArray2D<std::size_t>::host_mirror_type group_starts_h{};
+  std::vector<const Variable<Real> *> group_vars;
+  // False if any region belongs to a variable without refinement operations
+  bool all_regions_in_subsets = true;
 
   void clear() {
     prores_info = ProResInfoArr_t{};
@@ -146,16 +284,25 @@ struct ProResCache_t {
     buffer_subset_sizes.clear();
     buffer_subsets = ParArray2D<std::size_t>{};
     buffer_subsets_h = ParArray2D<std::size_t>::host_mirror_type{};
+    group_subset_sizes.clear();
+    group_starts = ParArray2D<std::size_t>{};
+    group_starts_h = ParArray2D<std::size_t>::host_mirror_type{};
+    group_vars.clear();
+    all_regions_in_subsets = true;
   }
 
-  void Initialize(int n_regions, StateDescriptor *pkg);
+  void Initialize(int n_regions, StateDescriptor *pkg,
+                  DevExecSpace exec_space_in = DevExecSpace());
 
   void RegisterRegionHost(int region, ProResInfo pri, Variable<Real> *v,
                           StateDescriptor *pkg);
 
   void CopyToDevice() {
-    Kokkos::deep_copy(prores_info, prores_info_h);
-    Kokkos::deep_copy(buffer_subsets, buffer_subsets_h);
+    for (std::size_t rfid = 0; rfid < group_subset_sizes.size(); ++rfid)
+      group_starts_h(rfid, group_subset_sizes[rfid]) = buffer_subset_sizes[rfid];
+    Kokkos::deep_copy(exec_space, prores_info, prores_info_h);
+    Kokkos::deep_copy(exec_space, buffer_subsets, buffer_subsets_h);
+    Kokkos::deep_copy(exec_space, group_starts, group_starts_h);
   }
 };
 
@@ -165,12 +312,15 @@ struct BvarsSubCache_t {
   void clear() {
     buf_vec.clear();
     idx_vec.clear();
+    unique_buf_idx.clear();
+    fence_before_handoff = false;
     if (sending_non_zero_flags.KokkosView().is_allocated())
       sending_non_zero_flags = ParArray1D<bool>{};
     if (sending_non_zero_flags_h.KokkosView().is_allocated())
       sending_non_zero_flags_h = ParArray1D<bool>::host_mirror_type{};
     bnd_info = BndInfoArr_t{};
     bnd_info_h = BndInfoArr_t::host_mirror_type{};
+    bnd_chunks = BndChunkArr_t{};
     prores_cache.clear();
   }
   // Stores prolongation and restriction information for boundary regions
@@ -178,6 +328,14 @@ struct BvarsSubCache_t {
 
   std::vector<std::size_t> idx_vec;
   std::vector<CommBuffer<buf_pool_t<Real>::owner_t> *> buf_vec;
+  // Index of the first entry of each distinct buffer in buf_vec. Combined flux
+  // corrections share a buffer between boundaries, but it must only be sent (and
+  // staled) once.
+  std::vector<std::size_t> unique_buf_idx;
+  // Whether some buffers are used on the host by MPI or by a block outside of the
+  // MeshData, which may run on another execution space instance. The pack (unpack)
+  // kernels then have to finish before the buffers are sent (staled).
+  bool fence_before_handoff = false;
   ParArray1D<bool> sending_non_zero_flags;
   // Cache both host and device buffer info. Reduces mallocs, and
   // also means the bounds values are available on host if needed.
@@ -185,6 +343,8 @@ struct BvarsSubCache_t {
 
   BndInfoArr_t bnd_info{};
   BndInfoArr_t::host_mirror_type bnd_info_h{};
+  // Work decomposition of bnd_info for the pack and unpack kernels
+  BndChunkArr_t bnd_chunks{};
 };
 
 struct BvarsCache_t {
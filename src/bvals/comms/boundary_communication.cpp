@@ -78,6 +78,7 @@ TaskStatus SendBoundBufs(std::shared_ptr<MeshData<Real>> &md) {
                                            ProResInfo::GetSend);
     }
   }
+
   // Restrict
   auto pmb = md->GetBlockData(0)->GetBlockPointer();
   StateDescriptor *resolved_packages = pmb->resolved_packages.get();
@@ -89,63 +90,59 @@ TaskStatus SendBoundBufs(std::shared_ptr<MeshData<Real>> &md) {
   PARTHENON_DEBUG_REQUIRE(bnd_info.size() == nbound, "Need same size for boundary info");
   auto &sending_nonzero_flags = cache.sending_non_zero_flags;
   auto &sending_nonzero_flags_h = cache.sending_non_zero_flags_h;
+  auto &bnd_chunks = cache.bnd_chunks;
 
+  // Buffers are split into chunks of similar size and flags are only ever set by the
+  // chunks of a buffer, so they have to be reset first
+  Kokkos::deep_copy(md->exec_space, sending_nonzero_flags.KokkosView(), false);
   Kokkos::parallel_for(
       PARTHENON_AUTO_LABEL,
-      Kokkos::TeamPolicy<>(parthenon::DevExecSpace(), nbound, Kokkos::AUTO),
+      Kokkos::TeamPolicy<>(md->exec_space, bnd_chunks.extent_int(0), Kokkos::AUTO),
       KOKKOS_LAMBDA(parthenon::team_mbr_t team_member) {
-        const int b = team_member.league_rank();
+        const auto &chunk = bnd_chunks(team_member.league_rank());
+        const int b = chunk.b;
 
-        if (!bnd_info(b).allocated || bnd_info(b).same_to_same) {
-          Kokkos::single(Kokkos::PerTeam(team_member),
-                         [&]() { sending_nonzero_flags(b) = false; });
-          return;
-        }
+        if (!bnd_info(b).allocated || bnd_info(b).same_to_same) return;
         Real threshold = bnd_info(b).var.allocation_threshold;
-        bool non_zero[3]{false, false, false};
-        int idx_offset = 0;
-        for (int it = 0; it < bnd_info(b).ntopological_elements; ++it) {
-          auto &idxer = bnd_info(b).idxer[it];
-          const int iel = static_cast<int>(bnd_info(b).topo_idx[it]) % 3;
-          const int Ni = idxer.template EndIdx<5>() - idxer.template StartIdx<5>() + 1;
-          Kokkos::parallel_reduce(
-              Kokkos::TeamThreadRange<>(team_member, idxer.size() / Ni),
-              [&](const int idx, bool &lnon_zero) {
-                const auto [t, u, v, k, j, i] = idxer(idx * Ni);
-                Real *var = &bnd_info(b).var(iel, t, u, v, k, j, i);
-                Real *buf = &bnd_info(b).buf(idx * Ni + idx_offset);
-
-                Kokkos::parallel_for(Kokkos::ThreadVectorRange<>(team_member, Ni),
-                                     [&](int m) { buf[m] = var[m]; });
-
-                bool mnon_zero = false;
-                Kokkos::parallel_reduce(
-                    Kokkos::ThreadVectorRange<>(team_member, Ni),
-                    [&](int m, bool &llnon_zero) {
-                      llnon_zero = llnon_zero || (std::abs(buf[m]) >= threshold);
-                    },
-                    Kokkos::LOr<bool, parthenon::DevMemSpace>(mnon_zero));
-
-                lnon_zero = lnon_zero || mnon_zero;
-                if (bound_type == BoundaryType::flxcor_send) lnon_zero = true;
-              },
-              Kokkos::LOr<bool, parthenon::DevMemSpace>(non_zero[iel]));
-          idx_offset += idxer.size();
-        }
+        bool non_zero = false;
+        auto &idxer = bnd_info(b).idxer[chunk.it];
+        const int iel = static_cast<int>(bnd_info(b).topo_idx[chunk.it]) % 3;
+        const int Ni = idxer.template EndIdx<5>() - idxer.template StartIdx<5>() + 1;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange<>(team_member, chunk.row_s, chunk.row_e),
+            [&](const int idx, bool &lnon_zero) {
+              const auto [t, u, v, k, j, i] = idxer(idx * Ni);
+              Real *var = &bnd_info(b).var(iel, t, u, v, k, j, i);
+              Real *buf = &bnd_info(b).buf(idx * Ni + chunk.buf_offset);
+
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange<>(team_member, Ni),
+                                   [&](int m) { buf[m] = var[m]; });
+
+              bool mnon_zero = false;
+              Kokkos::parallel_reduce(
+                  Kokkos::ThreadVectorRange<>(team_member, Ni),
+                  [&](int m, bool &llnon_zero) {
+                    llnon_zero = llnon_zero || (std::abs(buf[m]) >= threshold);
+                  },
+                  Kokkos::LOr<bool, parthenon::DevMemSpace>(mnon_zero));
+
+              lnon_zero = lnon_zero || mnon_zero;
+              if (bound_type == BoundaryType::flxcor_send) lnon_zero = true;
+            },
+            Kokkos::LOr<bool, parthenon::DevMemSpace>(non_zero));
+        // Chunks of the same buffer only ever store true, so this race is benign
         Kokkos::single(Kokkos::PerTeam(team_member), [&]() {
-          sending_nonzero_flags(b) = non_zero[0] || non_zero[1] || non_zero[2];
+          if (non_zero) sending_nonzero_flags(b) = true;
         });
       });
 
   // Send buffers
   if (Globals::sparse_config.enabled)
-    Kokkos::deep_copy(sending_nonzero_flags_h, sending_nonzero_flags);
-#ifdef MPI_PARALLEL
-  if (bound_type == BoundaryType::any || bound_type == BoundaryType::nonlocal)
-    Kokkos::fence();
-#endif
+    Kokkos::deep_copy(md->exec_space, sending_nonzero_flags_h, sending_nonzero_flags);
+  if (Globals::sparse_config.enabled || cache.fence_before_handoff)
+    md->exec_space.fence();
 
-  for (int ibuf = 0; ibuf < cache.buf_vec.size(); ++ibuf) {
+  for (const auto ibuf : cache.unique_buf_idx) {
     auto &buf = *cache.buf_vec[ibuf];
     if (sending_nonzero_flags_h(ibuf) || !Globals::sparse_config.enabled)
       buf.Send();
@@ -268,73 +265,20 @@ TaskStatus SetBounds(std::shared_ptr<MeshData<Real>> &md) {
   }
   // const Real threshold = Globals::sparse_config.allocation_threshold;
   auto &bnd_info = cache.bnd_info;
+  auto &bnd_chunks = cache.bnd_chunks;
   Kokkos::parallel_for(
       PARTHENON_AUTO_LABEL,
-      Kokkos::TeamPolicy<>(parthenon::DevExecSpace(), nbound, Kokkos::AUTO),
+      Kokkos::TeamPolicy<>(md->exec_space, bnd_chunks.extent_int(0), Kokkos::AUTO),
       KOKKOS_LAMBDA(parthenon::team_mbr_t team_member) {
-        const int b = team_member.league_rank();
+        const auto &chunk = bnd_chunks(team_member.league_rank());
+        const int b = chunk.b;
         if (bnd_info(b).same_to_same) return;
-        int idx_offset = 0;
-        for (int it = 0; it < bnd_info(b).ntopological_elements; ++it) {
-          auto &idxer = bnd_info(b).idxer[it];
-          auto &lcoord_trans = bnd_info(b).lcoord_trans;
-          auto &var = bnd_info(b).var;
-          const auto [tel, ftemp] =
-              lcoord_trans.InverseTransform(bnd_info(b).topo_idx[it]);
-          Real fac = ftemp; // Can't capture structured bindings
-          const int iel = static_cast<int>(tel) % 3;
-          const int Ni = idxer.template EndIdx<5>() - idxer.template StartIdx<5>() + 1;
-          if (bnd_info(b).buf_allocated && bnd_info(b).allocated) {
-            Kokkos::parallel_for(
-                Kokkos::TeamThreadRange<>(team_member, idxer.size() / Ni),
-                [&](const int idx) {
-                  Real *buf = &bnd_info(b).buf(idx * Ni + idx_offset);
-                  const auto [t, u, v, k, j, i] = idxer(idx * Ni);
-                  // Have to do this because of some weird issue about structure bindings
-                  // being captured
-                  const int tt = t;
-                  const int uu = u;
-                  const int vv = v;
-                  const int kk = k;
-                  const int jj = j;
-                  const int ii = i;
-                  Kokkos::parallel_for(
-                      Kokkos::ThreadVectorRange<>(team_member, Ni), [&](int m) {
-                        const auto [il, jl, kl] =
-                            lcoord_trans.InverseTransform({ii + m, jj, kk});
-                        if (idxer.IsActive(kl, jl, il))
-                          var(iel, tt, uu, vv, kl, jl, il) = fac * buf[m];
-                      });
-                });
-          } else if (bnd_info(b).allocated && bound_type != BoundaryType::flxcor_recv) {
-            const Real default_val = bnd_info(b).var.sparse_default_val;
-            Kokkos::parallel_for(
-                Kokkos::TeamThreadRange<>(team_member, idxer.size() / Ni),
-                [&](const int idx) {
-                  const auto [t, u, v, k, j, i] = idxer(idx * Ni);
-                  const int tt = t;
-                  const int uu = u;
-                  const int vv = v;
-                  const int kk = k;
-                  const int jj = j;
-                  const int ii = i;
-                  Kokkos::parallel_for(
-                      Kokkos::ThreadVectorRange<>(team_member, Ni), [&](int m) {
-                        const auto [il, jl, kl] =
-                            lcoord_trans.InverseTransform({ii + m, jj, kk});
-                        if (idxer.IsActive(kl, jl, il))
-                          var(iel, tt, uu, vv, kl, jl, il) = default_val;
-                      });
-                });
-          }
-          idx_offset += idxer.size();
-        }
+        bnd_info(b).SetRows(team_member, chunk.it, chunk.row_s, chunk.row_e,
+                            chunk.buf_offset, bound_type != BoundaryType::flxcor_recv);
       });
-#ifdef MPI_PARALLEL
-  Kokkos::fence();
-#endif
-  std::for_each(std::begin(cache.buf_vec), std::end(cache.buf_vec),
-                [](auto pbuf) { pbuf->Stale(); });
+  if (cache.fence_before_handoff) md->exec_space.fence();
+  for (const auto ibuf : cache.unique_buf_idx)
+    cache.buf_vec[ibuf]->Stale();
   if (nbound > 0 && pmesh->multilevel) {
     // Restrict
     auto pmb = md->GetBlockData(0)->GetBlockPointer();
@@ -399,6 +343,55 @@ ProlongateBounds<BoundaryType::nonlocal>(std::shared_ptr<MeshData<Real>> &);
 template TaskStatus
 ProlongateBounds<BoundaryType::gmg_prolongate_recv>(std::shared_ptr<MeshData<Real>> &);
 
+template <BoundaryType bound_type>
+TaskStatus SetBoundsAndProlongate(std::shared_ptr<MeshData<Real>> &md) {
+  PARTHENON_INSTRUMENT
+
+  Mesh *pmesh = md->GetMeshPointer();
+  auto &cache = md->GetBvarsCache().GetSubCache(bound_type, false);
+
+  auto [rebuild, nbound] = CheckReceiveBufferCacheForRebuild<bound_type, false>(md);
+  if (rebuild) {
+    RebuildBufferCache<bound_type, false>(md, nbound, BndInfo::GetSetBndInfo,
+                                          ProResInfo::GetSet);
+  }
+
+  // Physical boundary conditions have to be applied to the coarse buffer between
+  // restriction and prolongation, and variables without refinement operations are not
+  // unpacked by the fused kernel
+  bool fuse = nbound > 0 && pmesh->multilevel;
+  fuse = fuse && cache.prores_cache.all_regions_in_subsets;
+  for (int b = 0; fuse && b < md->NumBlocks(); ++b)
+    fuse = !HasPhysicalBoundary(md->GetBlockData(b)->GetBlockPointer());
+
+  if (!fuse) {
+    SetBounds<bound_type>(md);
+    if (pmesh->multilevel) {
+      ApplyBoundaryConditionsOnCoarseOrFineMD(md, true);
+      ProlongateBounds<bound_type>(md);
+    }
+    return TaskStatus::complete;
+  }
+
+  auto pmb = md->GetBlockData(0)->GetBlockPointer();
+  StateDescriptor *resolved_packages = pmb->resolved_packages.get();
+  refinement::SetAndProlongate(resolved_packages, cache.bnd_info, cache.prores_cache,
+                               pmb->cellbounds, pmb->c_cellbounds);
+  if (cache.fence_before_handoff) md->exec_space.fence();
+  for (const auto ibuf : cache.unique_buf_idx)
+    cache.buf_vec[ibuf]->Stale();
+  return TaskStatus::complete;
+}
+
+template TaskStatus
+SetBoundsAndProlongate<BoundaryType::any>(std::shared_ptr<MeshData<Real>> &);
+template TaskStatus
+SetBoundsAndProlongate<BoundaryType::local>(std::shared_ptr<MeshData<Real>> &);
+template TaskStatus
+SetBoundsAndProlongate<BoundaryType::nonlocal>(std::shared_ptr<MeshData<Real>> &);
+template TaskStatus
+SetBoundsAndProlongate<BoundaryType::gmg_same>(std::shared_ptr<MeshData<Real>> &);
+
 // Adds all relevant boundary communication to a single task list
 template <BoundaryType bounds>
 TaskID AddBoundaryExchangeTasks(TaskID dependency, TaskList &tl,
@@ -430,13 +423,7 @@ TaskID AddBoundaryExchangeTasks(TaskID dependency, TaskList &tl,
 
   auto send = tl.AddTask(dependency, TF(SendBoundBufs<bounds>), md);
   auto recv = tl.AddTask(dependency, TF(ReceiveBoundBufs<bounds>), md);
-  auto set = tl.AddTask(recv, TF(SetBounds<bounds>), md);
-
-  auto pro = set;
-  if (md->GetMeshPointer()->multilevel) {
-    auto cbound = tl.AddTask(set, TF(ApplyBoundaryConditionsOnCoarseOrFineMD), md, true);
-    pro = tl.AddTask(cbound, TF(ProlongateBounds<bounds>), md);
-  }
+  auto pro = tl.AddTask(recv, TF(SetBoundsAndProlongate<bounds>), md);
   auto fbound = tl.AddTask(pro, TF(ApplyBoundaryConditionsOnCoarseOrFineMD), md, false);
 
   return fbound;
@@ -44,26 +44,26 @@ template <BoundaryType BTYPE>
 void BuildBoundaryBufferSubset(std::shared_ptr<MeshData<Real>> &md,
                                Mesh::comm_buf_map_t &buf_map) {
   Mesh *pmesh = md->GetMeshPointer();
+  // The layouts of combined flux correction buffers are found once for all boundaries
+  CombinedFluxCorrectionLayouts_t flxcor_layouts;
+  if constexpr (BTYPE == BoundaryType::flxcor_send ||
+                BTYPE == BoundaryType::flxcor_recv) {
+    if (pmesh->CombineFluxCorrections())
+      flxcor_layouts = GetCombinedFluxCorrectionLayouts<BTYPE>(md, IsSender(BTYPE));
+  }
   ForEachBoundary<BTYPE>(md, [&](auto pmb, sp_mbd_t /*rc*/, nb_t &nb, const sp_cv_t v) {
-    // Calculate the required size of the buffer for this boundary
-    int buf_size = GetBufferSize(pmb, nb, v);
-    if (pmb->gid == nb.gid && nb.offsets.IsCell()) buf_size = 0;
-
-    // Add a buffer pool if one does not exist for this size
-    if (pmesh->pool_map.count(buf_size) == 0) {
-      pmesh->pool_map.emplace(std::make_pair(
-          buf_size, buf_pool_t<Real>([buf_size](buf_pool_t<Real> *pool) {
-            using buf_t = buf_pool_t<Real>::base_t;
-            // TODO(LFR): Make nbuf a user settable parameter
-            const int nbuf = 200;
-            buf_t chunk("pool buffer", buf_size * nbuf);
-            for (int i = 1; i < nbuf; ++i) {
-              pool->AddFreeObjectToPool(
-                  buf_t(chunk, std::make_pair(i * buf_size, (i + 1) * buf_size)));
-            }
-            return buf_t(chunk, std::make_pair(0, buf_size));
-          })));
-    }
+    // Calculate the required sizes of the buffers for this boundary. Ranges are
+    // compacted by the ownership of the sending block, so the message pmb sends to nb
+    // and the one it receives from nb can have different sizes.
+    auto buf_size = [&](bool sender) {
+      // Combined flux corrections share a buffer holding all dense flux variables
+      if constexpr (BTYPE == BoundaryType::flxcor_send ||
+                    BTYPE == BoundaryType::flxcor_recv) {
+        if (UseCombinedFluxCorrection(pmb, *v))
+          return flxcor_layouts.at(FluxCorrectionLayoutKey(pmb, nb)).size;
+      }
+      return GetBufferSize(pmb, nb, v, sender);
+    };
 
     const int receiver_rank = nb.rank;
     const int sender_rank = Globals::my_rank;
@@ -72,7 +72,7 @@ void BuildBoundaryBufferSubset(std::shared_ptr<MeshData<Real>> &md,
 #ifdef MPI_PARALLEL
     // Get a bi-directional mpi tag for this pair of blocks
     tag = pmesh->tag_map.GetTag(pmb, nb);
-    auto comm_label = v->label();
+    auto comm_label = ChannelLabel(pmb, v, BTYPE);
     mpi_comm_t comm = pmesh->GetMPIComm(comm_label);
 #else
       // Setting to zero is fine here since this doesn't actually get used when everything
@@ -81,27 +81,34 @@ void BuildBoundaryBufferSubset(std::shared_ptr<MeshData<Real>> &md,
 #endif
 
     bool use_sparse_buffers = v->IsSet(Metadata::Sparse);
-    auto get_resource_method = [pmesh, buf_size]() {
-      return buf_pool_t<Real>::owner_t(pmesh->pool_map.at(buf_size).Get());
+    // Buffers are acquired from task threads, so the pool is looked up here rather than
+    // in the resource getter
+    auto get_resource_method = [pmesh](const int buf_size) {
+      auto *pool = &pmesh->GetBufferPool(buf_size);
+      return [pool]() { return buf_pool_t<Real>::owner_t(pool->Get()); };
     };
 
     // Build send buffer (unless this is a receiving flux boundary)
     if constexpr (IsSender(BTYPE)) {
       auto s_key = SendKey(pmb, nb, v, BTYPE);
-      if (buf_map.count(s_key) == 0)
+      if (buf_map.count(s_key) == 0) {
+        const int size = buf_size(true);
         buf_map[s_key] = CommBuffer<buf_pool_t<Real>::owner_t>(
-            tag, sender_rank, receiver_rank, comm, get_resource_method,
+            tag, sender_rank, receiver_rank, comm, get_resource_method(size),
             use_sparse_buffers);
+      }
     }
 
     // Also build the non-local receive buffers here
     if constexpr (IsReceiver(BTYPE)) {
       if (sender_rank != receiver_rank) {
         auto r_key = ReceiveKey(pmb, nb, v, BTYPE);
-        if (buf_map.count(r_key) == 0)
+        if (buf_map.count(r_key) == 0) {
+          const int size = buf_size(false);
           buf_map[r_key] = CommBuffer<buf_pool_t<Real>::owner_t>(
-              tag, receiver_rank, sender_rank, comm, get_resource_method,
+              tag, receiver_rank, sender_rank, comm, get_resource_method(size),
               use_sparse_buffers);
+        }
       }
     }
   });
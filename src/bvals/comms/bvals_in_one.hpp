@@ -38,6 +38,10 @@ class NeighborBlock;
 template <typename T>
 class Variable;
 
+// Variable label used in the channel keys and for the MPI communicator of flux
+// correction messages that combine all dense flux variables of a boundary
+inline const std::string combined_flxcor_label = "parthenon::combined_flux_correction";
+
 template <BoundaryType bound_type>
 TaskStatus SendBoundBufs(std::shared_ptr<MeshData<Real>> &md);
 template <BoundaryType bound_type>
@@ -66,6 +70,11 @@ inline TaskStatus ProlongateBoundaries(std::shared_ptr<MeshData<Real>> &md) {
   return ProlongateBounds<BoundaryType::any>(md);
 }
 
+// Sets the boundaries and, on multilevel meshes, prolongates from the coarse buffer.
+// Where possible, unpacking, restriction and prolongation happen in a single kernel.
+template <BoundaryType bound_type>
+TaskStatus SetBoundsAndProlongate(std::shared_ptr<MeshData<Real>> &md);
+
 static TaskStatus StartReceiveFluxCorrections(std::shared_ptr<MeshData<Real>> &md) {
   return StartReceiveBoundBufs<BoundaryType::flxcor_recv>(md);
 }
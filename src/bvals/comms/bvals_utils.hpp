@@ -18,15 +18,18 @@
 #define BVALS_COMMS_BVALS_UTILS_HPP_
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <random>
 #include <string>
 #include <tuple>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "bvals/comms/bnd_info.hpp"
 #include "bvals/comms/bvals_in_one.hpp"
+#include "globals.hpp"
 #include "interface/variable.hpp"
 #include "mesh/domain.hpp"
 #include "mesh/mesh.hpp"
@@ -40,6 +43,16 @@ inline auto &GetReceiverGid(Mesh::channel_key_t &key) { return std::get<1>(key);
 inline auto &GetVariable(Mesh::channel_key_t &key) { return std::get<2>(key); }
 inline auto &GetLocIdx(Mesh::channel_key_t &key) { return std::get<3>(key); }
 
+// Label of the channel that the boundary data of pcv is communicated through
+inline std::string ChannelLabel(const MeshBlock *pmb,
+                                const std::shared_ptr<Variable<Real>> &pcv,
+                                BoundaryType btype) {
+  if ((btype == BoundaryType::flxcor_send || btype == BoundaryType::flxcor_recv) &&
+      UseCombinedFluxCorrection(pmb, *pcv))
+    return combined_flxcor_label;
+  return pcv->label();
+}
+
 inline Mesh::channel_key_t SendKey(const MeshBlock *pmb, const NeighborBlock &nb,
                                    const std::shared_ptr<Variable<Real>> &pcv,
                                    BoundaryType btype) {
@@ -50,7 +63,7 @@ inline Mesh::channel_key_t SendKey(const MeshBlock *pmb, const NeighborBlock &nb
                                       btype == BoundaryType::gmg_restrict_send))
                   ? 1
                   : 0;
-  return {sender_id, receiver_id, pcv->label(), location_idx, other};
+  return {sender_id, receiver_id, ChannelLabel(pmb, pcv, btype), location_idx, other};
 }
 
 inline Mesh::channel_key_t ReceiveKey(const MeshBlock *pmb, const NeighborBlock &nb,
@@ -63,7 +76,52 @@ inline Mesh::channel_key_t ReceiveKey(const MeshBlock *pmb, const NeighborBlock
                                       btype == BoundaryType::gmg_restrict_send))
                   ? 1
                   : 0;
-  return {sender_id, receiver_id, pcv->label(), location_idx, other};
+  return {sender_id, receiver_id, ChannelLabel(pmb, pcv, btype), location_idx, other};
+}
+
+// Combined flux correction layouts of the boundaries of a MeshData, keyed by the gid of
+// the block, the gid of the neighbor, and the index of the neighbor offsets
+using flxcor_layout_key_t = std::tuple<int, int, int>;
+using CombinedFluxCorrectionLayouts_t =
+    std::map<flxcor_layout_key_t, CombinedFluxCorrectionLayout>;
+
+inline flxcor_layout_key_t FluxCorrectionLayoutKey(const MeshBlock *pmb,
+                                                   const NeighborBlock &nb) {
+  return {pmb->gid, nb.gid, nb.offsets.GetIdx()};
+}
+
+// Lay out the combined flux correction buffers of all flux correction boundaries of md
+// that pmb sends (sender = true) or receives. The layout of a boundary is found from all
+// dense flux variables of the base container of the block rather than from the
+// variables of md. The buffer of a boundary is only allocated once, so this keeps
+// MeshData holding shallow copies or subsets of the variables consistent with it and
+// with the other side of the boundary. Variables are ordered by label so that both
+// sides of a boundary agree on the layout.
+template <BoundaryType BOUND_TYPE>
+inline CombinedFluxCorrectionLayouts_t
+GetCombinedFluxCorrectionLayouts(std::shared_ptr<MeshData<Real>> &md, bool sender) {
+  static_assert(BOUND_TYPE == BoundaryType::flxcor_send ||
+                    BOUND_TYPE == BoundaryType::flxcor_recv,
+                "Only flux correction boundaries are combined");
+  CombinedFluxCorrectionLayouts_t layouts;
+  loops::ForEachBoundary<BOUND_TYPE>(
+      md, [&](auto pmb, loops::shorthands::sp_mbd_t /*rc*/, loops::shorthands::nb_t &nb,
+              const loops::shorthands::sp_cv_t v) {
+        if (!UseCombinedFluxCorrection(pmb, *v)) return;
+        const auto key = FluxCorrectionLayoutKey(pmb, nb);
+        if (layouts.count(key) > 0) return;
+        std::map<std::string, int> var_sizes;
+        for (auto &vb : pmb->meshblock_data.Get()->GetVariableVector()) {
+          if (UseCombinedFluxCorrection(pmb, *vb) && NeedsFluxCorrection(nb, *vb))
+            var_sizes[vb->label()] = GetBufferSize(pmb, nb, vb, sender);
+        }
+        auto &layout = layouts[key];
+        for (const auto &[label, size] : var_sizes) {
+          layout.ranges[label] = {layout.size, layout.size + size};
+          layout.size += size;
+        }
+      });
+  return layouts;
 }
 
 // Build a vector of pointers to all of the sending or receiving communication buffers on
@@ -126,6 +184,13 @@ void InitializeBufferCache(std::shared_ptr<MeshData<Real>> &md, COMM_MAP *comm_m
     (pcache->idx_vec)[std::get<1>(t)] = buff_idx++;
   });
 
+  pcache->unique_buf_idx.clear();
+  std::unordered_set<CommBuffer<buf_pool_t<Real>::owner_t> *> seen_bufs;
+  for (std::size_t ibuf = 0; ibuf < pcache->buf_vec.size(); ++ibuf) {
+    if (seen_bufs.insert(pcache->buf_vec[ibuf]).second)
+      pcache->unique_buf_idx.push_back(ibuf);
+  }
+
   const int nbound = pcache->buf_vec.size();
   if (initialize_flags && nbound > 0) {
     if (nbound != pcache->sending_non_zero_flags.size()) {
@@ -224,13 +289,42 @@ inline void RebuildBufferCache(std::shared_ptr<MeshData<Real>> md, int nbound,
   // this.
   Mesh *pmesh = md->GetParentPointer();
   StateDescriptor *pkg = (pmesh->resolved_packages).get();
-  cache.prores_cache.Initialize(nbound, pkg);
+  cache.prores_cache.Initialize(nbound, pkg, md->exec_space);
+
+  // The layouts of combined flux correction buffers are found once for all boundaries
+  CombinedFluxCorrectionLayouts_t flxcor_layouts;
+  if constexpr (BOUND_TYPE == BoundaryType::flxcor_send ||
+                BOUND_TYPE == BoundaryType::flxcor_recv) {
+    if (pmesh->CombineFluxCorrections())
+      flxcor_layouts = GetCombinedFluxCorrectionLayouts<BOUND_TYPE>(md, SENDER);
+  }
+
+  std::unordered_set<int> gids_in_md;
+  for (int b = 0; b < md->NumBlocks(); ++b)
+    gids_in_md.insert(md->GetBlockData(b)->GetBlockPointer()->gid);
+  const bool several_instances = pmesh->NumExecSpaceInstances() > 1;
+  cache.fence_before_handoff = false;
 
   int ibound = 0;
   ForEachBoundary<BOUND_TYPE>(md, [&](auto pmb, sp_mbd_t rc, nb_t &nb, const sp_cv_t v) {
+    if (nb.rank != Globals::my_rank ||
+        (several_instances && gids_in_md.count(nb.gid) == 0))
+      cache.fence_before_handoff = true;
+
     // bnd_info
     const std::size_t ibuf = cache.idx_vec[ibound];
     cache.bnd_info_h(ibuf) = BndInfoCreator(pmb, nb, v, cache.buf_vec[ibuf]);
+    if constexpr (BOUND_TYPE == BoundaryType::flxcor_send ||
+                  BOUND_TYPE == BoundaryType::flxcor_recv) {
+      // Point at the range of the shared buffer that holds this variable
+      auto &buf = cache.bnd_info_h(ibuf).buf;
+      if (UseCombinedFluxCorrection(pmb, *v) && buf.size() > 0) {
+        const auto &layout = flxcor_layouts.at(FluxCorrectionLayoutKey(pmb, nb));
+        const auto range = layout.ranges.at(v->label());
+        buf = buf_pool_t<Real>::base_t(
+            Kokkos::subview(static_cast<const buf_pool_t<Real>::base_t &>(buf), range));
+      }
+    }
 
     // subsets ordering is same as in cache.bnd_info
     // RefinementFunctions_t owns all relevant functionality, so
@@ -240,8 +334,16 @@ inline void RebuildBufferCache(std::shared_ptr<MeshData<Real>> md, int nbound,
 
     ++ibound;
   });
-  Kokkos::deep_copy(cache.bnd_info, cache.bnd_info_h);
+  Kokkos::deep_copy(md->exec_space, cache.bnd_info, cache.bnd_info_h);
   cache.prores_cache.CopyToDevice();
+
+  const auto chunks = GetBndChunks(cache.bnd_info_h);
+  cache.bnd_chunks = BndChunkArr_t("bnd_chunks", chunks.size());
+  auto bnd_chunks_h = Kokkos::create_mirror_view(cache.bnd_chunks);
+  for (int c = 0; c < chunks.size(); ++c)
+    bnd_chunks_h(c) = chunks[c];
+  // The mirror goes out of scope, so this copy cannot be asynchronous
+  Kokkos::deep_copy(cache.bnd_chunks, bnd_chunks_h);
 }
 
 } // namespace parthenon
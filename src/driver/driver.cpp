@@ -215,6 +215,8 @@ void EvolutionDriver::SetGlobalTimeStep() {
     tm.dt = std::min(tm.dt, pmb->NewDt());
     pmb->SetAllowedDt(big);
   }
+  // estimates that were left on device are brought back with a single transfer
+  tm.dt = std::min(tm.dt, pmesh->ReduceDeviceDtEstimates());
 
 #ifdef MPI_PARALLEL
   PARTHENON_MPI_CHECK(MPI_Allreduce(MPI_IN_PLACE, &tm.dt, 1, MPI_PARTHENON_REAL, MPI_MIN,
@@ -43,11 +43,15 @@ Real receive_boundary_buffer_timeout;
 // timeouts for tasks
 Real current_task_runtime_sec;
 
+// the total time (in seconds) spent executing tasks that did not return incomplete, used
+// to measure the throughput of this rank for load balancing
+Real task_busy_time_sec = 0.0;
+
 namespace refinement {
 // Communication buffers are packed into a `BndInfo` object.
-// if the size of this object is greater than min_num_bufs,
-// hierarchical parallelism is used for prolongation/restriction.
-// otherwise one kernel per buffer is launched.
+// Prolongation/restriction is done in a single kernel with one team
+// per buffer. If there are fewer than min_num_bufs buffers, they are
+// split over several teams where the operation allows it.
 int min_num_bufs;
 } // namespace refinement
 
@@ -41,12 +41,13 @@ extern SparseConfig sparse_config;
 
 extern Real receive_boundary_buffer_timeout;
 extern Real current_task_runtime_sec;
+extern Real task_busy_time_sec;
 
 namespace refinement {
 // Communication buffers are packed into a `BndInfo` object.
-// if the size of this object is greater than min_num_bufs,
-// hierarchical parallelism is used for prolongation/restriction.
-// otherwise one kernel per buffer is launched.
+// Prolongation/restriction is done in a single kernel with one team
+// per buffer. If there are fewer than min_num_bufs buffers, they are
+// split over several teams where the operation allows it.
 extern int min_num_bufs;
 } // namespace refinement
 
@@ -30,6 +30,7 @@ void MeshData<T>::Initialize(BlockList_t blocks, Mesh *pmesh,
   } else {
     grid = GridIdentifier::leaf();
   }
+  exec_space = DevExecSpace();
 }
 
 // This method is basically here to get around the forward
@@ -195,7 +195,13 @@ class MeshData {
   explicit MeshData(const std::string &name) : stage_name_(name) {}
 
   GridIdentifier grid;
-  int partition;
+  int partition = -1;
+  // Execution space instance used for kernels and copies acting on this partition
+  DevExecSpace exec_space;
+
+  // With several instances, kernels acting on the blocks of this partition have to be
+  // launched on exec_space (or the equal pmb->exec_space of its leaf blocks) so that
+  // they are ordered with respect to the framework's work on the partition.
 
   const auto &StageName() const { return stage_name_; }
 
@@ -256,6 +262,7 @@ class MeshData {
       block_data_[i] = bl[i]->meshblock_data.Add(stage_name_, bl[i], vars);
     grid = part->grid;
     partition = part->partition;
+    exec_space = part->exec_space;
   }
 
   template <typename ID_t>
@@ -274,6 +281,7 @@ class MeshData {
     }
     grid = src->grid;
     partition = src->partition;
+    exec_space = src->exec_space;
   }
 
   void Initialize(BlockList_t blocks, Mesh *pmesh, std::optional<int> gmg_level = {});
@@ -18,12 +18,15 @@
 #include <memory>
 #include <set>
 #include <sstream>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "globals.hpp"
+#include "interface/make_pack_descriptor.hpp"
 #include "interface/metadata.hpp"
+#include "interface/sparse_pack.hpp"
 #include "interface/state_descriptor.hpp"
 #include "interface/variable.hpp"
 #include "interface/variable_pack.hpp"
@@ -85,7 +88,15 @@ const VariableFluxPack<T> &MeshBlockData<T>::PackListedVariablesAndFluxes(
     FluxPackIndxPair<T> new_item;
     new_item.alloc_status = var_list.alloc_status();
     new_item.flux_alloc_status = flux_list.alloc_status();
-    new_item.pack = MakeFluxPack(var_list, flux_list, &new_item.map);
+    // Fluxes must be in the same order as their variables to share the storage
+    const auto &vars = var_list.vars();
+    const auto &flux_vars = flux_list.vars();
+    bool same_order = (vars.size() == flux_vars.size());
+    for (int i = 0; same_order && i < vars.size(); ++i) {
+      same_order = (vars[i]->metadata().GetFluxName() == flux_vars[i]->label());
+    }
+    auto *storage = same_order ? GetSparsePackStorage(var_list, false, true) : nullptr;
+    new_item.pack = MakeFluxPack(var_list, flux_list, &new_item.map, storage);
     new_item.pack.coords = GetParentPointer()->coords_device;
     itr = varFluxPackMap_.insert({keys, new_item}).first;
 
@@ -136,7 +147,8 @@ MeshBlockData<T>::PackListedVariables(const VarList &var_list, bool coarse,
   if (make_new_pack) {
     PackIndxPair<T> new_item;
     new_item.alloc_status = var_list.alloc_status();
-    new_item.pack = MakePack<T>(var_list, coarse, &new_item.map);
+    new_item.pack = MakePack<T>(var_list, coarse, &new_item.map,
+                                GetSparsePackStorage(var_list, coarse, false));
     new_item.pack.coords = GetParentPointer()->coords_device;
 
     itr = packmap.insert({key, new_item}).first;
@@ -155,6 +167,51 @@ MeshBlockData<T>::PackListedVariables(const VarList &var_list, bool coarse,
   return itr->second.pack;
 }
 
+/// Legacy packs keep a slot for every listed variable, while SparsePacks only contain
+/// allocated variables. If all variables are allocated, both lay out the same
+/// components in the same order, so the legacy pack can view into the SparsePack over
+/// the same variables instead of building and storing its own view of views. The
+/// SparsePack is taken from (or added to) the SparsePackCache, so it is shared with any
+/// SparsePack user requesting the same variables, as are the index arrays of all legacy
+/// packs viewing into it.
+template <typename T>
+SparsePackStorage<Real> *
+MeshBlockData<T>::GetSparsePackStorage(const VarList &var_list, bool coarse,
+                                       bool with_fluxes) {
+  if constexpr (!std::is_same<T, Real>::value) {
+    return nullptr;
+  } else {
+    const auto &vars = var_list.vars();
+    if ((resolved_packages == nullptr) || vars.empty()) return nullptr;
+
+    int vsize = 0;
+    for (const auto &v : vars) {
+      if (!v->IsAllocated()) return nullptr;
+      // Face and edge fluxes are arranged differently in legacy flux packs
+      if (with_fluxes && (v->IsSet(Metadata::Face) || v->IsSet(Metadata::Edge))) {
+        return nullptr;
+      }
+      vsize += v->NumComponents();
+    }
+
+    std::set<PDOpt> options;
+    if (coarse) options.insert(PDOpt::Coarse);
+    if (with_fluxes) options.insert(PDOpt::WithFluxes);
+    // One group per variable preserves the order of the list
+    auto desc =
+        MakePackDescriptor(resolved_packages.get(), var_list.unique_ids(), {}, options);
+    auto pack = desc.GetPack(this);
+    auto &storage = sparse_pack_cache_.GetLegacyStorage(desc.identifier);
+
+    // Variables that are not known to the resolved packages are missing from the pack
+    if ((pack.GetSize() != vsize) || (storage.views.extent_int(1) != 1) ||
+        (storage.views.extent_int(2) != vsize)) {
+      return nullptr;
+    }
+    return &storage;
+  }
+}
+
 /***********************************/
 /* PACK VARIABLES INTERFACE        */
 /***********************************/
@@ -797,6 +797,11 @@ class MeshBlockData {
                                              PackIndexMap *map,
                                              vpack_types::VPackKey_t *key);
 
+  // Returns the storage of the SparsePack over the variables in var_list if a legacy
+  // pack over them can be a window into it, or nullptr otherwise
+  SparsePackStorage<Real> *GetSparsePackStorage(const VarList &var_list, bool coarse,
+                                                bool with_fluxes);
+
   const VariablePack<T> &PackVariablesImpl(const std::vector<std::string> &names,
                                            const std::vector<int> &sparse_ids,
                                            bool coarse, PackIndexMap *map,
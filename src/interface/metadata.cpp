@@ -252,6 +252,24 @@ bool Metadata::IsValid(bool throw_on_fail) const {
     }
   }
 
+  // Component innermost layout
+  if (IsSet(ComponentInnermost)) {
+    if (Where() != Cell || IsSet(WithFluxes)) {
+      valid = false;
+      if (throw_on_fail) {
+        PARTHENON_THROW(
+            "Only cell variables without fluxes can store their components innermost");
+      }
+    }
+    if (HasRefinementOps() && !refinement_funcs_.component_innermost) {
+      valid = false;
+      if (throw_on_fail) {
+        PARTHENON_THROW("Refinement ops of a variable with the component innermost "
+                        "layout must accept strided arrays");
+      }
+    }
+  }
+
   // Prolongation/restriction
   if (HasRefinementOps()) {
     if (refinement_funcs_.label().size() == 0) {
@@ -120,6 +120,8 @@
   PARTHENON_INTERNAL_FOR_FLAG(Fine)                                                      \
   /** this variable is the flux for another variable **/                                 \
   PARTHENON_INTERNAL_FOR_FLAG(Flux)                                                      \
+  /** the components of each cell are stored contiguously **/                            \
+  PARTHENON_INTERNAL_FOR_FLAG(ComponentInnermost)                                        \
   /************************************************/                                     \
   /** Vars specifying coordinates for visualization purposes **/                         \
   /** You can specify a single 3D var **/                                                \
@@ -383,6 +385,16 @@ class Metadata {
   parthenon::Real GetAllocationThreshold() const { return allocation_threshold_; }
   parthenon::Real GetDefaultValue() const { return default_value_; }
 
+  // Number of ghost zones of the variable that are filled by boundary communication.
+  // Variables with narrower stencils than the widest one in the simulation can set this
+  // to reduce the amount of data that is communicated. Zero, the default, fills all
+  // ghost zones.
+  void SetGhostDepth(int depth) {
+    PARTHENON_REQUIRE_THROWS(depth >= 0, "Ghost depth must be non-negative");
+    ghost_depth_ = depth;
+  }
+  int GetGhostDepth() const { return ghost_depth_; }
+
   // Individual flag setters, using these could result in an invalid set of flags, use
   // IsValid to check if the flags are valid
   // TODO(JMM): This is dangerous. See Issue #844.
@@ -536,6 +548,10 @@ class Metadata {
     refinement_funcs_ =
         refinement::RefinementFunctions_t::RegisterOps<ProlongationOp, RestrictionOp,
                                                        InternalProlongationOp>();
+    PARTHENON_REQUIRE_THROWS(!IsSet(ComponentInnermost) ||
+                                 refinement_funcs_.component_innermost,
+                             "Refinement ops of a variable with the component innermost "
+                             "layout must accept strided arrays");
   }
 
   // Operators
@@ -562,7 +578,7 @@ class Metadata {
   }
 
   bool operator==(const Metadata &b) const {
-    return HasSameFlags(b) && (shape_ == b.shape_);
+    return HasSameFlags(b) && (shape_ == b.shape_) && (ghost_depth_ == b.ghost_depth_);
 
     // associated_ can be used by downstream codes to associate some variables with
     // others, and component_labels_ are used in output files to label components of
@@ -597,6 +613,7 @@ class Metadata {
   parthenon::Real allocation_threshold_;
   parthenon::Real deallocation_threshold_;
   parthenon::Real default_value_;
+  int ghost_depth_ = 0;
 
   /// if flag is true set bit, clears otherwise
   void DoBit(MetadataFlag bit, bool flag) {
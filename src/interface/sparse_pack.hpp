@@ -128,6 +128,17 @@ class SparsePack : public SparsePackBase {
   KOKKOS_INLINE_FUNCTION
   const Coordinates_t &GetCoordinates(const int b = 0) const { return coords_(b)(); }
 
+  // Work list of the allocated (block, variable) pairs in the pack, i.e. of the pairs
+  // (b, n) with GetLowerBound(b) <= n <= GetUpperBound(b), ordered by block
+  KOKKOS_FORCEINLINE_FUNCTION
+  int GetNumActive() const { return nactive_; }
+  KOKKOS_FORCEINLINE_FUNCTION
+  int GetActiveBlock(const int a) const { return active_(0, a); }
+  KOKKOS_FORCEINLINE_FUNCTION
+  int GetActiveVar(const int a) const { return active_(1, a); }
+  int GetActiveBlockHost(const int a) const { return active_h_(0, a); }
+  int GetActiveVarHost(const int a) const { return active_h_(1, a); }
+
   // Bound overloads
   KOKKOS_INLINE_FUNCTION int GetLowerBound(const int b) const {
     return (flat_ && (b > 0)) ? (bounds_(1, b - 1, nvar_) + 1) : 0;
@@ -289,17 +300,17 @@ class SparsePack : public SparsePackBase {
   Real &operator()(const int b, const int idx, const int k, const int j,
                    const int i) const {
     PARTHENON_DEBUG_REQUIRE(!flat_, "Accessor cannot be used for flat packs");
-    return pack_(0, b, idx)(k, j, i);
+    return Cell(pack_(0, b, idx), k, j, i);
   }
   KOKKOS_INLINE_FUNCTION
   Real &operator()(int idx, const int k, const int j, const int i) const {
     PARTHENON_DEBUG_REQUIRE(flat_, "Accessor valid only for flat packs");
-    return pack_(0, 0, idx)(k, j, i);
+    return Cell(pack_(0, 0, idx), k, j, i);
   }
 
   KOKKOS_INLINE_FUNCTION Real &operator()(const int b, const TE el, const int idx,
                                           const int k, const int j, const int i) const {
-    return pack_(static_cast<int>(el) % 3, b, idx)(k, j, i);
+    return Cell(pack_(static_cast<int>(el) % 3, b, idx), k, j, i);
   }
 
   KOKKOS_INLINE_FUNCTION Real &operator()(const int b, PackIdx idx, const int k,
@@ -307,14 +318,14 @@ class SparsePack : public SparsePackBase {
     static_assert(sizeof...(Ts) == 0, "Cannot create a string/type hybrid pack");
     PARTHENON_DEBUG_REQUIRE(!flat_, "Accessor cannot be used for flat packs");
     const int n = bounds_(0, b, idx.VariableIdx()) + idx.Offset();
-    return pack_(0, b, n)(k, j, i);
+    return Cell(pack_(0, b, n), k, j, i);
   }
 
   KOKKOS_INLINE_FUNCTION Real &operator()(const int b, const TE el, PackIdx idx,
                                           const int k, const int j, const int i) const {
     static_assert(sizeof...(Ts) == 0, "Cannot create a string/type hybrid pack");
     const int n = bounds_(0, b, idx.VariableIdx()) + idx.Offset();
-    return pack_(static_cast<int>(el) % 3, b, n)(k, j, i);
+    return Cell(pack_(static_cast<int>(el) % 3, b, n), k, j, i);
   }
 
   template <class TIn, REQUIRES(IncludesType<TIn, Ts...>::value)>
@@ -322,14 +333,14 @@ class SparsePack : public SparsePackBase {
                                           const int j, const int i) const {
     PARTHENON_DEBUG_REQUIRE(!flat_, "Accessor cannot be used for flat packs");
     const int vidx = GetLowerBound(b, t) + t.idx;
-    return pack_(0, b, vidx)(k, j, i);
+    return Cell(pack_(0, b, vidx), k, j, i);
   }
 
   template <class TIn, REQUIRES(IncludesType<TIn, Ts...>::value)>
   KOKKOS_INLINE_FUNCTION Real &operator()(const int b, const TE el, const TIn &t,
                                           const int k, const int j, const int i) const {
     const int vidx = GetLowerBound(b, t) + t.idx;
-    return pack_(static_cast<int>(el) % 3, b, vidx)(k, j, i);
+    return Cell(pack_(static_cast<int>(el) % 3, b, vidx), k, j, i);
   }
 
   // flux() overloads
@@ -392,6 +403,24 @@ class SparsePack : public SparsePackBase {
                                       VTs... vts) const {
     return std::make_tuple(&(*this)(b, el, vts, k, j, i)...);
   }
+
+  // Whether the cells of every entry follow each other in x1, which is not the case for
+  // variables with Metadata::ComponentInnermost. Kernels that walk over the cells of an
+  // entry through raw pointers require this.
+  bool ContiguousCellsHost() const {
+    for (int n = 0; n < pack_h_.extent_int(0); ++n)
+      for (int b = 0; b < pack_h_.extent_int(1); ++b)
+        for (int idx = 0; idx < pack_h_.extent_int(2); ++idx)
+          if (pack_h_(n, b, idx).i_stride != 1) return false;
+    return true;
+  }
+
+ private:
+  KOKKOS_FORCEINLINE_FUNCTION
+  static Real &Cell(const ParArray3D<Real, VariableState> &v, const int k, const int j,
+                    const int i) {
+    return v(k, j, v.StorageI(i));
+  }
 };
 
 template <typename... Vars>
@@ -407,6 +436,37 @@ inline std::ostream &operator<<(std::ostream &os, const SparsePack<Vars...> &sp)
   return os;
 }
 
+// Loops over the cells in the index ranges of every allocated (block, variable) pair of
+// the pack, calling function(b, n, k, j, i). In contrast to looping over all blocks and
+// the maximum number of variables per block, no work is launched for pairs that are not
+// allocated, so the cost of the loop scales with the allocated volume.
+template <class Function, class... Ts>
+inline void par_for_active(const std::string &name, DevExecSpace exec_space,
+                           const SparsePack<Ts...> &pack, const IndexRange &kb,
+                           const IndexRange &jb, const IndexRange &ib,
+                           const Function &function) {
+  par_for(
+      DEFAULT_LOOP_PATTERN, name, exec_space, 0, pack.GetNumActive() - 1, kb.s, kb.e,
+      jb.s, jb.e, ib.s, ib.e,
+      KOKKOS_LAMBDA(const int a, const int k, const int j, const int i) {
+        function(pack.GetActiveBlock(a), pack.GetActiveVar(a), k, j, i);
+      });
+}
+
+// Hierarchical version of par_for_active that launches one team per allocated
+// (block, variable) pair and calls function(team_member, b, n)
+template <class Function, class... Ts>
+inline void par_for_active_outer(const std::string &name, DevExecSpace exec_space,
+                                 const SparsePack<Ts...> &pack,
+                                 const size_t scratch_size_in_bytes,
+                                 const int scratch_level, const Function &function) {
+  par_for_outer(
+      DEFAULT_OUTER_LOOP_PATTERN, name, exec_space, scratch_size_in_bytes, scratch_level,
+      0, pack.GetNumActive() - 1, KOKKOS_LAMBDA(team_mbr_t member, const int a) {
+        function(member, pack.GetActiveBlock(a), pack.GetActiveVar(a));
+      });
+}
+
 } // namespace parthenon
 
 #endif // INTERFACE_SPARSE_PACK_HPP_
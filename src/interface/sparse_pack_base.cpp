@@ -224,11 +224,7 @@ SparsePackBase SparsePackBase::Build(T *pmd, const PackDescriptor &desc,
 
                   } else { // This is a cell, node, or a variable that doesn't have
                            // topology information
-                    if (pack.coarse_) {
-                      pack.pack_h_(0, b, idx) = pv->coarse_s.Get(0, t, u, v);
-                    } else {
-                      pack.pack_h_(0, b, idx) = pv->data.Get(0, t, u, v);
-                    }
+                    pack.pack_h_(0, b, idx) = pv->GetComponent(t, u, v, pack.coarse_);
                     if (pv->IsSet(Metadata::Vector))
                       pack.pack_h_(0, b, idx).vector_component = v + 1;
                   }
@@ -272,8 +268,26 @@ SparsePackBase SparsePackBase::Build(T *pmd, const PackDescriptor &desc,
     pack.bounds_h_(1, blidx, nvar) = idx - 1;
     blidx++;
   });
+
+  // Build the list of allocated (block, variable) pairs so that kernels can skip the
+  // pairs that do not have to be touched
+  pack.nactive_ = pack.size_;
+  pack.active_ = active_t("active", 2, std::max(pack.nactive_, 1));
+  pack.active_h_ = Kokkos::create_mirror_view(pack.active_);
+  int nactive = 0;
+  for (int b = 0; b < nblocks; ++b) {
+    const int lo = (desc.flat && (b > 0)) ? pack.bounds_h_(1, b - 1, nvar) + 1 : 0;
+    for (int n = lo; n <= pack.bounds_h_(1, b, nvar); ++n) {
+      pack.active_h_(0, nactive) = b;
+      pack.active_h_(1, nactive) = n;
+      nactive++;
+    }
+  }
+  PARTHENON_REQUIRE(nactive == pack.nactive_, "Inconsistent number of active variables.");
+
   Kokkos::deep_copy(pack.pack_, pack.pack_h_);
   Kokkos::deep_copy(pack.bounds_, pack.bounds_h_);
+  Kokkos::deep_copy(pack.active_, pack.active_h_);
   Kokkos::deep_copy(pack.coords_, coords_h);
 
   return pack;
@@ -324,9 +338,12 @@ template <class T>
 SparsePackBase &SparsePackCache::BuildAndAdd(T *pmd, const PackDescriptor &desc,
                                              const std::vector<bool> &include_block) {
   if (pack_map.count(desc.identifier) > 0) pack_map.erase(desc.identifier);
-  pack_map[desc.identifier] = {SparsePackBase::Build(pmd, desc, include_block),
+  auto pack = SparsePackBase::Build(pmd, desc, include_block);
+  SparsePackStorage<Real> legacy_storage;
+  legacy_storage.views = pack.pack_;
+  pack_map[desc.identifier] = {pack,
                                SparsePackBase::GetAllocStatus(pmd, desc, include_block),
-                               include_block};
+                               include_block, legacy_storage};
   return std::get<0>(pack_map[desc.identifier]);
 }
 template SparsePackBase &
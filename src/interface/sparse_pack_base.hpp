@@ -29,6 +29,7 @@
 #include "coordinates/coordinates.hpp"
 #include "interface/state_descriptor.hpp"
 #include "interface/variable.hpp"
+#include "interface/variable_pack.hpp"
 #include "interface/variable_state.hpp"
 #include "utils/utils.hpp"
 
@@ -59,6 +60,8 @@ class SparsePackBase {
   using pack_h_t = typename pack_t::HostMirror;
   using bounds_t = ParArray3D<int>;
   using bounds_h_t = typename bounds_t::HostMirror;
+  using active_t = ParArray2D<int>;
+  using active_h_t = typename active_t::HostMirror;
   using coords_t = ParArray1D<ParArray0D<Coordinates_t>>;
 
   // Returns a SparsePackBase object that is either newly created or taken
@@ -90,6 +93,10 @@ class SparsePackBase {
   pack_h_t pack_h_;
   bounds_t bounds_;
   bounds_h_t bounds_h_;
+  // List of the (block, variable) pairs in the pack that are allocated, indexed by
+  // (0 = block / 1 = variable, pair)
+  active_t active_;
+  active_h_t active_h_;
   coords_t coords_;
 
   int flx_idx_;
@@ -99,6 +106,7 @@ class SparsePackBase {
   int nblocks_;
   int nvar_;
   int size_;
+  int nactive_;
 };
 
 // Object for cacheing sparse packs in MeshData and MeshBlockData objects. This
@@ -111,6 +119,12 @@ class SparsePackCache {
 
   void clear() { pack_map.clear(); }
 
+  // Storage of the cached pack with the given identifier for legacy VariablePacks, which
+  // can be windows into single block packs. The pack must be in the cache.
+  SparsePackStorage<Real> &GetLegacyStorage(const std::string &identifier) {
+    return std::get<3>(pack_map.at(identifier));
+  }
+
  protected:
   template <class T>
   SparsePackBase &Get(T *pmd, const impl::PackDescriptor &desc,
@@ -120,8 +134,9 @@ class SparsePackCache {
   SparsePackBase &BuildAndAdd(T *pmd, const impl::PackDescriptor &desc,
                               const std::vector<bool> &include_block);
 
-  std::unordered_map<std::string, std::tuple<SparsePackBase, SparsePackBase::alloc_t,
-                                             SparsePackBase::include_t>>
+  std::unordered_map<std::string,
+                     std::tuple<SparsePackBase, SparsePackBase::alloc_t,
+                                SparsePackBase::include_t, SparsePackStorage<Real>>>
       pack_map;
 
   friend class SparsePackBase;
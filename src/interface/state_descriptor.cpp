@@ -13,6 +13,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -20,8 +21,10 @@
 #include <vector>
 
 #include "basic_types.hpp"
+#include "interface/mesh_data.hpp"
 #include "interface/metadata.hpp"
 #include "interface/state_descriptor.hpp"
+#include "kokkos_abstraction.hpp"
 #include "utils/error_checking.hpp"
 
 namespace parthenon {
@@ -412,6 +415,21 @@ void StateDescriptor::InvertControllerMap() {
                 });
 }
 
+Real StateDescriptor::EstimateTimestep(MeshData<Real> *rc) const {
+  if (EstimateTimestepMesh != nullptr) return EstimateTimestepMesh(rc);
+  const Real big = std::numeric_limits<Real>::max();
+  if (EstimateTimestepMeshOnDevice == nullptr) return big;
+  // Only partitions of the leaf grid have a slot for the estimate on device, so other
+  // MeshData wait for it here
+  ParArray0D<Real> dt_min("dt_min");
+  Kokkos::deep_copy(rc->exec_space, dt_min.KokkosView(), big);
+  EstimateTimestepMeshOnDevice(rc, dt_min);
+  auto dt_min_h = Kokkos::create_mirror_view(HostMemSpace(), dt_min.KokkosView());
+  Kokkos::deep_copy(rc->exec_space, dt_min_h, dt_min.KokkosView());
+  rc->exec_space.fence();
+  return dt_min_h();
+}
+
 // Takes all packages and combines them into a single state descriptor
 // containing all variables with conflicts resolved.  Note the new
 // state descriptor DOES not have any of its function pointers set.
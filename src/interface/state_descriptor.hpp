@@ -392,9 +392,15 @@ class StateDescriptor {
     if (EstimateTimestepBlock != nullptr) return EstimateTimestepBlock(rc);
     return std::numeric_limits<Real>::max();
   }
-  Real EstimateTimestep(MeshData<Real> *rc) const {
-    if (EstimateTimestepMesh != nullptr) return EstimateTimestepMesh(rc);
-    return std::numeric_limits<Real>::max();
+  // Falls back to EstimateTimestepMeshOnDevice, whose estimate is then returned to the
+  // host, if the package only provides the device-side variant
+  Real EstimateTimestep(MeshData<Real> *rc) const;
+  // Device-side variant that combines the estimate with the one already in dt_min
+  // without returning it to the host. Returns false if the package does not provide it.
+  bool EstimateTimestep(MeshData<Real> *rc, ParArray0D<Real> dt_min) const {
+    if (EstimateTimestepMeshOnDevice == nullptr) return false;
+    EstimateTimestepMeshOnDevice(rc, dt_min);
+    return true;
   }
 
   AmrTag CheckRefinement(MeshBlockData<Real> *rc) const {
@@ -449,6 +455,8 @@ class StateDescriptor {
 
   std::function<Real(MeshBlockData<Real> *rc)> EstimateTimestepBlock = nullptr;
   std::function<Real(MeshData<Real> *rc)> EstimateTimestepMesh = nullptr;
+  std::function<void(MeshData<Real> *rc, ParArray0D<Real> dt_min)>
+      EstimateTimestepMeshOnDevice = nullptr;
 
   std::function<AmrTag(MeshBlockData<Real> *rc)> CheckRefinementBlock = nullptr;
 
@@ -36,6 +36,7 @@
 #include "metadata.hpp"
 #include "parthenon_arrays.hpp"
 #include "parthenon_mpi.hpp"
+#include "swarm_comm_termination.hpp"
 #include "swarm_device_context.hpp"
 #include "variable.hpp"
 #include "variable_pack.hpp"
@@ -221,15 +222,18 @@ class Swarm {
 
   void ResetCommunication();
 
-  bool FinalizeCommunicationIterative();
+  // Ends a round of an iterative exchange of particles, in which received particles
+  // are transported further and sent on again. Returns iterate while particles are in
+  // flight anywhere on the mesh and complete once the exchange is finished.
+  TaskStatus FinalizeCommunicationIterative();
 
   template <class T>
   SwarmVariablePack<T> PackVariables(const std::vector<std::string> &name,
                                      PackIndexMap &vmap);
 
   // Temporarily public
-  int num_particles_sent_;
-  bool finished_transport;
+  int num_particles_sent_ = 0;
+  bool finished_transport = false;
 
   void LoadBuffers_(const int max_indices_size);
   void UnloadBuffers_();
@@ -297,6 +301,9 @@ class Swarm {
   std::vector<int> neighbor_received_particles_;
   int total_received_particles_;
 
+  // Round of the current iterative exchange of particles
+  SwarmCommTermination::BlockState comm_state_;
+
   ParArrayND<int> neighbor_buffer_index_; // Map from neighbor index to neighbor bufid
 
   ParArray1D<SwarmKey>
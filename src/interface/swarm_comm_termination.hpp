@@ -0,0 +1,79 @@
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+#ifndef INTERFACE_SWARM_COMM_TERMINATION_HPP_
+#define INTERFACE_SWARM_COMM_TERMINATION_HPP_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "basic_types.hpp"
+#include "parthenon_mpi.hpp"
+
+namespace parthenon {
+
+// Detects the end of an iterative particle exchange, in which received particles are
+// transported further and may be sent on again in the next round. Each block adds the
+// number of particles it sent in a round, and the sums of all blocks on all ranks are
+// computed by a non-blocking reduction that overlaps with the next round. If no particle
+// was sent in round r, nothing was received either, so no particle is sent in round
+// r + 1. Blocks therefore check the result of round r - 1 at the end of round r, and
+// all of them stop after the same round since they see the same reduction results.
+// One object is shared by all blocks of a rank for a given swarm.
+class SwarmCommTermination {
+ public:
+  // Round of the exchange a block is in
+  struct BlockState {
+    int round = 0;
+    bool contributed = false;
+  };
+
+  SwarmCommTermination();
+  SwarmCommTermination(const SwarmCommTermination &) = delete;
+  SwarmCommTermination &operator=(const SwarmCommTermination &) = delete;
+
+  // Must only be changed while no exchange is in progress
+  void SetNumBlocks(int nblocks) { nblocks_ = nblocks; }
+
+  // Called by each block at the end of every round, after its particles have been
+  // received, until it returns something other than incomplete. Returns iterate if
+  // another round is required and complete once the exchange is finished, in which
+  // case state is reset for the next exchange.
+  TaskStatus Finalize(BlockState *state, std::int64_t nsent);
+
+ private:
+  struct Round {
+    std::int64_t nsent = 0;
+    int ncontributed = 0;
+    int nchecked = 0;
+    bool started = false;
+#ifdef MPI_PARALLEL
+    MPI_Request req = MPI_REQUEST_NULL;
+#endif
+  };
+
+  bool TestRound_(Round *round);
+  void CheckOutRound_(int round);
+
+  int nblocks_ = 0;
+  std::mutex mutex_;
+  std::map<int, Round> rounds_;
+#ifdef MPI_PARALLEL
+  std::shared_ptr<MPI_Comm> pcomm_;
+#endif
+};
+
+} // namespace parthenon
+
+#endif // INTERFACE_SWARM_COMM_TERMINATION_HPP_
@@ -19,6 +19,7 @@
 
 #include "mesh/mesh.hpp"
 #include "swarm.hpp"
+#include "swarm_comm_termination.hpp"
 #include "swarm_default_names.hpp"
 #include "utils/error_checking.hpp"
 #include "utils/sort.hpp"
@@ -519,11 +520,94 @@ void Swarm::ResetCommunication() {
   }
 }
 
-bool Swarm::FinalizeCommunicationIterative() {
-  PARTHENON_THROW("FinalizeCommunicationIterative not yet implemented!");
+TaskStatus Swarm::FinalizeCommunicationIterative() {
+  auto pmb = GetBlockPointer();
+  std::int64_t nsent = 0;
+  if (!comm_state_.contributed) {
+    // Particles of this round have been received, so buffers can be reused
+    ResetCommunication();
+    if (pmb->neighbors.size() > 0) nsent = num_particles_sent_;
+  }
+  auto &termination = pmb->pmy_mesh->GetSwarmCommTermination(label_);
+  const auto status = termination.Finalize(&comm_state_, nsent);
+  finished_transport = (status == TaskStatus::complete);
+  return status;
+}
+
+SwarmCommTermination::SwarmCommTermination() {
+#ifdef MPI_PARALLEL
+  // Don't call MPI_Comm_free after MPI_Finalize
+  pcomm_ = std::shared_ptr<MPI_Comm>(new MPI_Comm, [](MPI_Comm *d) {
+    int finalized;
+    PARTHENON_MPI_CHECK(MPI_Finalized(&finalized));
+    if (!finalized) PARTHENON_MPI_CHECK(MPI_Comm_free(d));
+    delete d;
+  });
+  PARTHENON_MPI_CHECK(MPI_Comm_dup(MPI_COMM_WORLD, pcomm_.get()));
+#endif
+}
+
+TaskStatus SwarmCommTermination::Finalize(BlockState *state, std::int64_t nsent) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!state->contributed) {
+    auto &round = rounds_[state->round];
+    round.nsent += nsent;
+    round.ncontributed++;
+    if (round.ncontributed == nblocks_) {
+#ifdef MPI_PARALLEL
+      PARTHENON_MPI_CHECK(MPI_Iallreduce(MPI_IN_PLACE, &round.nsent, 1, MPI_INT64_T,
+                                         MPI_SUM, *pcomm_, &round.req));
+#endif
+      round.started = true;
+    }
+    state->contributed = true;
+  }
+
+  // The first round can't be checked against a previous one
+  if (state->round == 0) {
+    state->round++;
+    state->contributed = false;
+    return TaskStatus::iterate;
+  }
+
+  auto &previous = rounds_.at(state->round - 1);
+  if (!TestRound_(&previous)) return TaskStatus::incomplete;
+  if (previous.nsent > 0) {
+    CheckOutRound_(state->round - 1);
+    state->round++;
+    state->contributed = false;
+    return TaskStatus::iterate;
+  }
+
+  // Nothing is in flight anymore. The reduction of the current round, which must also
+  // find no sent particles, is still completed so that no request is left pending.
+  auto &current = rounds_.at(state->round);
+  if (!TestRound_(&current)) return TaskStatus::incomplete;
+  PARTHENON_DEBUG_REQUIRE(current.nsent == 0, "Particles sent after exchange finished");
+  CheckOutRound_(state->round - 1);
+  CheckOutRound_(state->round);
+  *state = BlockState();
+  return TaskStatus::complete;
+}
+
+bool SwarmCommTermination::TestRound_(Round *round) {
+  if (!round->started) return false;
+#ifdef MPI_PARALLEL
+  if (round->req != MPI_REQUEST_NULL) {
+    int done;
+    PARTHENON_MPI_CHECK(MPI_Test(&round->req, &done, MPI_STATUS_IGNORE));
+    return done;
+  }
+#endif
   return true;
 }
 
+void SwarmCommTermination::CheckOutRound_(int round) {
+  // Every block checks out every round exactly once, after which it can be dropped
+  auto it = rounds_.find(round);
+  if (++(it->second.nchecked) == nblocks_) rounds_.erase(it);
+}
+
 void Swarm::AllocateComms(std::weak_ptr<MeshBlock> wpmb) {
   if (wpmb.expired()) return;
 
@@ -15,7 +15,9 @@
 #include <utility>
 #include <vector>
 
+#include "bvals/boundary_conditions.hpp"
 #include "globals.hpp" // my_rank
+#include "interface/mesh_data.hpp"
 #include "mesh/mesh.hpp"
 #include "swarm_container.hpp"
 #include "utils/error_checking.hpp"
@@ -208,6 +210,68 @@ TaskStatus SwarmContainer::Receive(BoundaryCommSubset phase) {
   return TaskStatus::incomplete;
 }
 
+TaskStatus SwarmContainer::ReceiveNoBoundaryConditions(BoundaryCommSubset phase) {
+  PARTHENON_INSTRUMENT
+
+  // Swarms that already received all of their boundaries find no new particles on
+  // subsequent calls
+  bool all_received = true;
+  for (auto &s : swarmVector_) {
+    all_received = s->Receive(phase) && all_received;
+  }
+
+  if (all_received) return TaskStatus::complete;
+  return TaskStatus::incomplete;
+}
+
+TaskStatus ReceiveSwarmsMD(std::shared_ptr<MeshData<Real>> &md,
+                           BoundaryCommSubset phase) {
+  PARTHENON_INSTRUMENT
+
+  bool all_received = true;
+  for (int b = 0; b < md->NumBlocks(); ++b) {
+    const auto status = md->GetSwarmData(b)->ReceiveNoBoundaryConditions(phase);
+    all_received = (status == TaskStatus::complete) && all_received;
+  }
+  if (!all_received) return TaskStatus::incomplete;
+
+  ApplySwarmBoundaryConditionsMD(md);
+  for (int b = 0; b < md->NumBlocks(); ++b) {
+    for (auto &s : md->GetSwarmData(b)->allSwarms()) {
+      s->RemoveMarkedParticles();
+    }
+  }
+  return TaskStatus::complete;
+}
+
+TaskStatus FinalizeSwarmCommsIterativeMD(std::shared_ptr<MeshData<Real>> &md) {
+  PARTHENON_INSTRUMENT
+
+  // The reduction of a round may finish while the blocks are being finalized, so some
+  // blocks can be done with a round before others. They are not finalized again, which
+  // would move them on to the next round, until all blocks of md are done.
+  bool any_incomplete = false;
+  bool any_iterate = false;
+  for (int b = 0; b < md->NumBlocks(); ++b) {
+    auto sc = md->GetSwarmData(b);
+    if (sc->round_status_ == TaskStatus::incomplete) {
+      sc->round_status_ = sc->FinalizeCommunicationIterative();
+    }
+    any_incomplete = any_incomplete || (sc->round_status_ == TaskStatus::incomplete);
+    any_iterate = any_iterate || (sc->round_status_ == TaskStatus::iterate);
+  }
+  if (any_incomplete) return TaskStatus::incomplete;
+
+  for (int b = 0; b < md->NumBlocks(); ++b) {
+    auto sc = md->GetSwarmData(b);
+    // All blocks see the same reduction results and hence finish in the same round
+    PARTHENON_DEBUG_REQUIRE((sc->round_status_ == TaskStatus::iterate) == any_iterate,
+                            "Blocks finished the particle exchange in different rounds");
+    sc->round_status_ = TaskStatus::incomplete;
+  }
+  return any_iterate ? TaskStatus::iterate : TaskStatus::complete;
+}
+
 TaskStatus SwarmContainer::ResetCommunication() {
   PARTHENON_INSTRUMENT
 
@@ -221,18 +285,26 @@ TaskStatus SwarmContainer::ResetCommunication() {
 TaskStatus SwarmContainer::FinalizeCommunicationIterative() {
   PARTHENON_INSTRUMENT
 
-  PARTHENON_THROW("FinalizeCommunicationIterative not yet fully implemented!")
-
-  int success = 0, total = 0;
+  // All swarms take part in every round. A swarm whose exchange is finished only has its
+  // buffers reset until the exchanges of the other swarms are done as well.
+  bool any_incomplete = false;
+  bool any_iterate = false;
   for (auto &s : swarmVector_) {
-    if (s->FinalizeCommunicationIterative()) {
-      success++;
+    if (s->finished_transport) {
+      s->ResetCommunication();
+      continue;
     }
-    total++;
+    const auto status = s->FinalizeCommunicationIterative();
+    any_incomplete = any_incomplete || (status == TaskStatus::incomplete);
+    any_iterate = any_iterate || (status == TaskStatus::iterate);
   }
 
-  if (success == total) return TaskStatus::complete;
-  return TaskStatus::incomplete;
+  if (any_incomplete) return TaskStatus::incomplete;
+  if (any_iterate) return TaskStatus::iterate;
+  for (auto &s : swarmVector_) {
+    s->finished_transport = false;
+  }
+  return TaskStatus::complete;
 }
 
 void SwarmContainer::ClearBoundary(BoundaryCommSubset phase) {}
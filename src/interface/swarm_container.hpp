@@ -36,6 +36,8 @@ namespace parthenon {
 ///
 
 class MeshBlock;
+template <typename T>
+class MeshData;
 
 class SwarmContainer {
  public:
@@ -161,6 +163,9 @@ class SwarmContainer {
   TaskStatus StartCommunication(BoundaryCommSubset phase);
   TaskStatus Send(BoundaryCommSubset phase);
   TaskStatus Receive(BoundaryCommSubset phase);
+  // Receive without applying boundary conditions or removing marked particles, which is
+  // left to ReceiveSwarmsMD
+  TaskStatus ReceiveNoBoundaryConditions(BoundaryCommSubset phase);
   TaskStatus ResetCommunication();
   TaskStatus FinalizeCommunicationIterative();
   [[deprecated("Not yet implemented")]] void ClearBoundary(BoundaryCommSubset phase);
@@ -197,7 +202,22 @@ class SwarmContainer {
   SwarmVector swarmVector_ = {};
   SwarmMap swarmMap_ = {};
   SwarmMetadataMap swarmMetadataMap_ = {};
+
+  // Result of FinalizeCommunicationIterative in the current round of an exchange driven
+  // by FinalizeSwarmCommsIterativeMD
+  TaskStatus round_status_ = TaskStatus::incomplete;
+  friend TaskStatus FinalizeSwarmCommsIterativeMD(std::shared_ptr<MeshData<Real>> &md);
 };
 
+// Receive the particles of all swarms on the blocks of md. Once every block has received,
+// the swarm boundary conditions are applied to the whole partition at once.
+TaskStatus ReceiveSwarmsMD(std::shared_ptr<MeshData<Real>> &md,
+                           BoundaryCommSubset phase);
+
+// Completion task of an iterative particle exchange over the blocks of md, see
+// SwarmContainer::FinalizeCommunicationIterative. Returns incomplete until every block
+// has finished the round, then iterate or complete for the partition as a whole.
+TaskStatus FinalizeSwarmCommsIterativeMD(std::shared_ptr<MeshData<Real>> &md);
+
 } // namespace parthenon
 #endif // INTERFACE_SWARM_CONTAINER_HPP_
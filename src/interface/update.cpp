@@ -33,6 +33,12 @@ namespace parthenon {
 
 namespace Update {
 
+DevExecSpace GetExecSpace(MeshData<Real> *md) { return md->exec_space; }
+
+DevExecSpace GetExecSpace(MeshBlockData<Real> *mbd) {
+  return mbd->GetBlockPointer()->exec_space;
+}
+
 template <>
 TaskStatus FluxDivergence(MeshBlockData<Real> *in, MeshBlockData<Real> *dudt_cont) {
   MeshBlock *pmb = in->GetBlockPointer();
@@ -71,8 +77,8 @@ TaskStatus FluxDivergence(MeshData<Real> *in_obj, MeshData<Real> *dudt_obj) {
 
   const int ndim = vin.GetNdim();
   parthenon::par_for(
-      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, DevExecSpace(), 0, vin.GetDim(5) - 1, 0,
-      vin.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, in_obj->exec_space, 0, vin.GetDim(5) - 1,
+      0, vin.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
       KOKKOS_LAMBDA(const int m, const int l, const int k, const int j, const int i) {
         if (dudt.IsAllocated(m, l) && vin.IsAllocated(m, l)) {
           const auto &coords = vin.GetCoords(m);
@@ -126,7 +132,7 @@ TaskStatus UpdateWithFluxDivergence(MeshData<Real> *u0_data, MeshData<Real> *u1_
 
   const int ndim = u0_pack.GetNdim();
   parthenon::par_for(
-      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, DevExecSpace(), 0,
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, u0_data->exec_space, 0,
       u0_pack.GetDim(5) - 1, 0, u0_pack.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
       KOKKOS_LAMBDA(const int m, const int l, const int k, const int j, const int i) {
         if (u0_pack.IsAllocated(m, l) && u1_pack.IsAllocated(m, l)) {
@@ -161,35 +167,31 @@ TaskStatus SparseDealloc(MeshData<Real> *md) {
   const int Nk = kb.e + 1 - kb.s;
   const int NjNi = Nj * Ni;
   const int NkNjNi = Nk * NjNi;
-  Kokkos::parallel_for(
-      PARTHENON_AUTO_LABEL,
-      Kokkos::TeamPolicy<>(parthenon::DevExecSpace(), pack.GetNBlocks(), Kokkos::AUTO),
-      KOKKOS_LAMBDA(parthenon::team_mbr_t team_member) {
-        const int b = team_member.league_rank();
-
-        const int lo = pack.GetLowerBound(b);
-        const int hi = pack.GetUpperBound(b);
-
-        for (int v = lo; v <= hi; ++v) {
-          const auto &var = pack(b, v);
-          const Real threshold = var.deallocation_threshold;
-          bool all_zero = true;
-          const auto &var_raw = var.data();
-          Kokkos::parallel_reduce(
-              Kokkos::TeamThreadRange<>(team_member, var.size()),
-              [&](const int idx, bool &lall_zero) {
-                if (std::abs(var_raw[idx]) > threshold) {
-                  lall_zero = false;
-                  return;
-                }
-              },
-              Kokkos::LAnd<bool, DevMemSpace>(all_zero));
-          Kokkos::single(Kokkos::PerTeam(team_member),
-                         [&]() { is_zero(b, v) = all_zero; });
-        }
+  par_for_active_outer(
+      PARTHENON_AUTO_LABEL, md->exec_space, pack, 0, 0,
+      KOKKOS_LAMBDA(parthenon::team_mbr_t team_member, const int b, const int v) {
+        const auto &var = pack(b, v);
+        const Real threshold = var.deallocation_threshold;
+        bool all_zero = true;
+        const auto &var_raw = var.data();
+        // Only every i_stride'th element belongs to this component
+        const int stride = var.i_stride;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange<>(team_member, var.size() / stride),
+            [&](const int idx, bool &lall_zero) {
+              if (std::abs(var_raw[var.StorageI(idx)]) > threshold) {
+                lall_zero = false;
+                return;
+              }
+            },
+            Kokkos::LAnd<bool, DevMemSpace>(all_zero));
+        Kokkos::single(Kokkos::PerTeam(team_member), [&]() { is_zero(b, v) = all_zero; });
       });
 
-  auto is_zero_h = Kokkos::create_mirror_view_and_copy(HostMemSpace(), is_zero);
+  auto is_zero_h = Kokkos::create_mirror_view(HostMemSpace(), is_zero);
+  Kokkos::deep_copy(md->exec_space, is_zero_h, is_zero);
+  // The flags are read on the host right away
+  md->exec_space.fence();
 
   for (int b = 0; b < pack.GetNBlocks(); ++b) {
     for (auto &control_var : control_vars) {
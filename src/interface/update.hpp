@@ -55,6 +55,11 @@ Real FluxDivHelper(const int l, const int k, const int j, const int i, const int
   return -du / coords.CellVolume(k, j, i);
 }
 
+// Execution space instance that kernels acting on the data are launched on, so that
+// they are ordered with respect to the framework's work on the same blocks
+DevExecSpace GetExecSpace(MeshData<Real> *md);
+DevExecSpace GetExecSpace(MeshBlockData<Real> *mbd);
+
 template <typename T>
 TaskStatus FluxDivergence(T *in, T *dudt_obj);
 
@@ -75,8 +80,8 @@ TaskStatus WeightedSumData(const F &flags, T *in1, T *in2, const Real w1, const
   const auto &y = in2->PackVariables(flags);
   const auto &z = out->PackVariables(flags);
   parthenon::par_for(
-      PARTHENON_AUTO_LABEL, 0, x.GetDim(5) - 1, 0, x.GetDim(4) - 1, 0, x.GetDim(3) - 1, 0,
-      x.GetDim(2) - 1, 0, x.GetDim(1) - 1,
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, GetExecSpace(out), 0, x.GetDim(5) - 1,
+      0, x.GetDim(4) - 1, 0, x.GetDim(3) - 1, 0, x.GetDim(2) - 1, 0, x.GetDim(1) - 1,
       KOKKOS_LAMBDA(const int b, const int l, const int k, const int j, const int i) {
         // TOOD(someone) This is potentially dangerous and/or not intended behavior
         // as we still may want to update (or populate) z if any of those vars are
@@ -98,8 +103,8 @@ TaskStatus SetDataToConstant(const F &flags, T *data, const Real val) {
   PARTHENON_INSTRUMENT
   const auto &x = data->PackVariables(flags);
   parthenon::par_for(
-      PARTHENON_AUTO_LABEL, 0, x.GetDim(5) - 1, 0, x.GetDim(4) - 1, 0, x.GetDim(3) - 1, 0,
-      x.GetDim(2) - 1, 0, x.GetDim(1) - 1,
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, GetExecSpace(data), 0, x.GetDim(5) - 1,
+      0, x.GetDim(4) - 1, 0, x.GetDim(3) - 1, 0, x.GetDim(2) - 1, 0, x.GetDim(1) - 1,
       KOKKOS_LAMBDA(const int b, const int l, const int k, const int j, const int i) {
         if (x.IsAllocated(b, l)) {
           x(b, l, k, j, i) = val;
@@ -161,8 +166,8 @@ TaskStatus Update2S(const F &flags, T *s0_data, T *s1_data, T *rhs_data,
   Real gam0 = pint->gam0[stage - 1];
   Real gam1 = pint->gam1[stage - 1];
   parthenon::par_for(
-      PARTHENON_AUTO_LABEL, 0, s0.GetDim(5) - 1, 0, s0.GetDim(4) - 1, kb.s, kb.e, jb.s,
-      jb.e, ib.s, ib.e,
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, GetExecSpace(s0_data), 0,
+      s0.GetDim(5) - 1, 0, s0.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
       KOKKOS_LAMBDA(const int b, const int l, const int k, const int j, const int i) {
         if (s0.IsAllocated(b, l) && s1.IsAllocated(b, l) && rhs.IsAllocated(b, l)) {
           if (update_s1) {
@@ -198,9 +203,10 @@ TaskStatus SumButcher(const F &flags, std::shared_ptr<T> base_data,
   const IndexRange ib = out_data->GetBoundsI(interior);
   const IndexRange jb = out_data->GetBoundsJ(interior);
   const IndexRange kb = out_data->GetBoundsK(interior);
+  const auto exec_space = GetExecSpace(out_data.get());
   parthenon::par_for(
-      PARTHENON_AUTO_LABEL, 0, out.GetDim(5) - 1, 0, out.GetDim(4) - 1, kb.s, kb.e, jb.s,
-      jb.e, ib.s, ib.e,
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, exec_space, 0, out.GetDim(5) - 1, 0,
+      out.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
       KOKKOS_LAMBDA(const int b, const int l, const int k, const int j, const int i) {
         if (out.IsAllocated(b, l) && in.IsAllocated(b, l)) {
           out(b, l, k, j, i) = in(b, l, k, j, i);
@@ -210,8 +216,8 @@ TaskStatus SumButcher(const F &flags, std::shared_ptr<T> base_data,
     Real a = pint->a[stage - 1][prev];
     const auto &in = stage_data[stage]->PackVariables(flags);
     parthenon::par_for(
-        PARTHENON_AUTO_LABEL, 0, out.GetDim(5) - 1, 0, out.GetDim(4) - 1, kb.s, kb.e,
-        jb.s, jb.e, ib.s, ib.e,
+        DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, exec_space, 0, out.GetDim(5) - 1, 0,
+        out.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
         KOKKOS_LAMBDA(const int b, const int l, const int k, const int j, const int i) {
           if (out.IsAllocated(b, l) && in.IsAllocated(b, l)) {
             out(b, l, k, j, i) += dt * a * in(b, l, k, j, i);
@@ -242,13 +248,14 @@ TaskStatus UpdateButcher(const F &flags, std::vector<std::shared_ptr<T>> stage_d
   const IndexRange jb = out_data->GetBoundsJ(interior);
   const IndexRange kb = out_data->GetBoundsK(interior);
 
+  const auto exec_space = GetExecSpace(out_data.get());
   const int nstages = pint->nstages;
   for (int stage = 0; stage < nstages; ++stage) {
     const Real butcher_b = pint->b[stage];
     const auto &in = stage_data[stage]->PackVariables(flags);
     parthenon::par_for(
-        PARTHENON_AUTO_LABEL, 0, out.GetDim(5) - 1, 0, out.GetDim(4) - 1, kb.s, kb.e,
-        jb.s, jb.e, ib.s, ib.e,
+        DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, exec_space, 0, out.GetDim(5) - 1, 0,
+        out.GetDim(4) - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
         KOKKOS_LAMBDA(const int b, const int l, const int k, const int j, const int i) {
           if (out.IsAllocated(b, l) && in.IsAllocated(b, l)) {
             out(b, l, k, j, i) += dt * b * in(b, l, k, j, i);
@@ -269,7 +276,18 @@ template <typename T>
 TaskStatus EstimateTimestep(T *rc) {
   PARTHENON_INSTRUMENT
   Real dt_min = std::numeric_limits<Real>::max();
+  int ipkg = 0;
   for (const auto &pkg : rc->GetParentPointer()->packages.AllPackages()) {
+    const int slot = ipkg++;
+    if constexpr (std::is_same_v<T, MeshData<Real>>) {
+      // Partitions of the leaf grid leave device-side estimates on the device, they are
+      // combined for all partitions in EvolutionDriver::SetGlobalTimeStep
+      auto pm = rc->GetParentPointer();
+      if (rc->grid.type == GridType::leaf && pm->HasDeviceDtEstimate(rc->partition) &&
+          pkg.second->EstimateTimestep(rc, pm->GetDeviceDtEstimate(rc->partition, slot))) {
+        continue;
+      }
+    }
     Real dt = pkg.second->EstimateTimestep(rc);
     dt_min = std::min(dt_min, dt);
   }
@@ -312,6 +330,15 @@ TaskStatus FillDerived(T *rc) {
   return TaskStatus::complete;
 }
 
+// Fill derived fields and estimate the timestep in a single pass over the packages, so
+// that the kernels of both are queued back-to-back without a host round-trip in between
+template <typename T>
+TaskStatus FillDerivedAndEstimateTimestep(T *rc) {
+  PARTHENON_INSTRUMENT
+  FillDerived(rc);
+  return EstimateTimestep(rc);
+}
+
 template <typename T>
 TaskStatus InitNewlyAllocatedVars(T *rc) {
   PARTHENON_INSTRUMENT
@@ -335,7 +362,7 @@ TaskStatus InitNewlyAllocatedVars(T *rc) {
 
     Kokkos::parallel_for(
         PARTHENON_AUTO_LABEL,
-        Kokkos::TeamPolicy<>(parthenon::DevExecSpace(), v.GetNBlocks(), Kokkos::AUTO),
+        Kokkos::TeamPolicy<>(GetExecSpace(rc), v.GetNBlocks(), Kokkos::AUTO),
         KOKKOS_LAMBDA(parthenon::team_mbr_t team_member) {
           const int b = team_member.league_rank();
           int lo = v.GetLowerBound(b, variable_names::any());
@@ -106,13 +106,66 @@ void Variable<T>::Allocate(std::weak_ptr<MeshBlock> wpmb, bool flag_uninitialize
   AllocateCoarse(wpmb);
 }
 
+template <typename T>
+ParArrayND<T, VariableState>
+Variable<T>::AllocateArray(const std::string &label,
+                           const std::array<int, MAX_VARIABLE_DIMENSION> &dims) const {
+  if (IsSet(Metadata::ComponentInnermost)) {
+    // Cell variables only have one topological element, and x1 is fused with the
+    // components so that the array is contiguous in (k, j, i, t, u, v)
+    return ParArrayND<T, VariableState>(label, MakeVariableState(), dims[2], dims[1],
+                                        dims[0] * dims[3] * dims[4] * dims[5]);
+  }
+  return std::make_from_tuple<ParArrayND<T, VariableState>>(std::tuple_cat(
+      std::make_tuple(label, MakeVariableState()), ArrayToReverseTuple(dims)));
+}
+
+template <typename T>
+ParArray3D<T, VariableState> Variable<T>::GetComponent(int t, int u, int v,
+                                                       bool coarse) const {
+  const auto &arr = coarse ? coarse_s : data;
+  if (!IsSet(Metadata::ComponentInnermost) || !arr.IsAllocated()) {
+    return ParArray3D<T, VariableState>(arr.Get(0, t, u, v));
+  }
+  // Every component is the whole array, so the view never extends past the allocation,
+  // and the component only enters through the offset in the fused x1
+  ParArray3D<T, VariableState> comp(arr.Get(0, 0, 0, 0));
+  comp.i_offset = (t * dims_[4] + u) * dims_[3] + v;
+  return comp;
+}
+
+template <typename T>
+Kokkos::LayoutStride Variable<T>::GetLogicalLayout(bool coarse) const {
+  const auto &d = coarse ? coarse_dims_ : dims_;
+  // Strides of (element, t, u, v, k, j, i), which is the reverse order of d
+  std::array<std::size_t, MAX_VARIABLE_DIMENSION> stride;
+  if (IsSet(Metadata::ComponentInnermost)) {
+    const std::size_t ncomp = d[3] * d[4] * d[5];
+    stride[3] = 1;
+    stride[2] = d[3];
+    stride[1] = d[3] * d[4];
+    stride[6] = ncomp;
+    stride[5] = ncomp * d[0];
+    stride[4] = ncomp * d[0] * d[1];
+    stride[0] = ncomp * d[0] * d[1] * d[2];
+  } else {
+    std::size_t s = 1;
+    for (int n = MAX_VARIABLE_DIMENSION - 1; n >= 0; --n) {
+      stride[n] = s;
+      s *= d[MAX_VARIABLE_DIMENSION - 1 - n];
+    }
+  }
+  return Kokkos::LayoutStride(d[6], stride[0], d[5], stride[1], d[4], stride[2], d[3],
+                              stride[3], d[2], stride[4], d[1], stride[5], d[0],
+                              stride[6]);
+}
+
 template <typename T>
 void Variable<T>::AllocateData(MeshBlock *pmb, bool flag_uninitialized) {
   PARTHENON_REQUIRE_THROWS(
       !is_allocated_,
       "Tried to allocate data for variable that's already allocated: " + label());
-  data = std::make_from_tuple<ParArrayND<T, VariableState>>(std::tuple_cat(
-      std::make_tuple(label(), MakeVariableState()), ArrayToReverseTuple(dims_)));
+  data = AllocateArray(label(), dims_);
 
   ++num_alloc_;
 
@@ -144,9 +197,7 @@ void Variable<T>::AllocateCoarse(std::weak_ptr<MeshBlock> wpmb) {
     std::shared_ptr<MeshBlock> pmb = wpmb.lock();
 
     if (pmb->pmy_mesh != nullptr && pmb->pmy_mesh->multilevel) {
-      coarse_s = std::make_from_tuple<ParArrayND<T, VariableState>>(
-          std::tuple_cat(std::make_tuple(label() + ".coarse", MakeVariableState()),
-                         ArrayToReverseTuple(coarse_dims_)));
+      coarse_s = AllocateArray(label() + ".coarse", coarse_dims_);
       pmb->LogMemUsage(coarse_s.size() * sizeof(T));
     }
   }
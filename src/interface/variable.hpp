@@ -135,6 +135,27 @@ class Variable {
 
   inline bool IsSet(const MetadataFlag bit) const { return m_.IsSet(bit); }
 
+  // Component (t, u, v) of data, or of coarse_s if coarse is true, as it is stored in
+  // packs. For variables with Metadata::ComponentInnermost, this is the whole array with
+  // x1 fused with the components, and cell i of the component is at StorageI(i).
+  ParArray3D<T, VariableState> GetComponent(int t, int u, int v,
+                                            bool coarse = false) const;
+
+  // Layout of data (or coarse_s) when indexed as (element, t, u, v, k, j, i), which is
+  // how data is indexed for variables without Metadata::ComponentInnermost
+  Kokkos::LayoutStride GetLogicalLayout(bool coarse = false) const;
+
+  // View of arr, which is data, coarse_s, or a mirror of either, that is indexed as
+  // (element, t, u, v, k, j, i) for any layout. The view does not keep arr alive.
+  template <class Array_t>
+  auto GetLogicalView(const Array_t &arr, bool coarse = false) const {
+    using base_t = typename Array_t::base_t;
+    using view_t = Kokkos::View<typename base_t::data_type, Kokkos::LayoutStride,
+                                typename base_t::memory_space>;
+    return ParArrayGeneric<view_t, VariableState>(
+        view_t(arr.data(), GetLogicalLayout(coarse)), arr);
+  }
+
   ParArrayND<T, VariableState> data;
   ParArrayND<T, VariableState> coarse_s; // used for sending coarse boundary calculation
 
@@ -173,6 +194,11 @@ class Variable {
 
   VariableState MakeVariableState() const { return VariableState(m_, sparse_id_, dims_); }
 
+  // allocate an array for data (or coarse_s) with logical dimensions dims
+  ParArrayND<T, VariableState>
+  AllocateArray(const std::string &label,
+                const std::array<int, MAX_VARIABLE_DIMENSION> &dims) const;
+
   Metadata m_;
   const std::string base_name_;
   const int sparse_id_;
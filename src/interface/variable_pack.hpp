@@ -265,10 +265,11 @@ class VariablePack {
 
   VariablePack(const ViewOfParArrays<T> &view, const ParArray1D<int> &sparse_ids,
                const ParArray1D<int> &vector_component, const ParArray1D<bool> &allocated,
-               const std::array<int, 4> &dims)
+               const std::array<int, 4> &dims,
+               const ParArray3D<ParArray3D<T, VariableState>> &storage = {})
       : v_(view), sparse_ids_(sparse_ids), vector_component_(vector_component),
         allocated_(allocated), dims_(dims),
-        ndim_((dims[2] > 1 ? 3 : (dims[1] > 1 ? 2 : 1))) {
+        ndim_((dims[2] > 1 ? 3 : (dims[1] > 1 ? 2 : 1))), storage_(storage) {
     // don't check length of allocation_status_, because it can be different from
     // dims_[3]. There is one entry in allocation_status_ per VARIABLE, but dims_[3] is
     // number of COMPONENTS (e.g. for a vector variable with 3 components, there will be
@@ -328,13 +329,14 @@ class VariablePack {
     assert(IsAllocated(n));
     assert(v_((static_cast<std::size_t>(el) % 3) * dims_[3] + n).topological_type ==
            GetTopologicalType(el));
-    return v_((static_cast<std::size_t>(el) % 3) * dims_[3] + n)(k, j, i);
+    const auto &v = v_((static_cast<std::size_t>(el) % 3) * dims_[3] + n);
+    return v(k, j, v.StorageI(i));
   }
   KOKKOS_FORCEINLINE_FUNCTION
   T &operator()(const int n, const int k, const int j, const int i) const {
     assert(IsAllocated(n));
     assert(v_(n).topological_type == TopologicalType::Cell);
-    return v_(n)(k, j, i);
+    return v_(n)(k, j, v_(n).StorageI(i));
   }
 
   // This is here so code templated on VariablePack and MeshBlockPack doesn't need to
@@ -399,6 +401,9 @@ class VariablePack {
   ParArray1D<bool> allocated_;
   std::array<int, 4> dims_;
   int ndim_;
+  // View of views of the SparsePack that v_ (and the fluxes) are windows into, if any.
+  // Holding on to it keeps the windows valid after the SparsePackCache rebuilds the pack.
+  ParArray3D<ParArray3D<T, VariableState>> storage_;
 
   // lives on host
   const std::vector<int> *alloc_status_;
@@ -440,8 +445,9 @@ class VariableFluxPack : public VariablePack<T> {
                    const ParArray1D<int> &sparse_ids,
                    const ParArray1D<int> &vector_component,
                    const ParArray1D<bool> &allocated, const std::array<int, 4> &dims,
-                   int fsize)
-      : VariablePack<T>(view, sparse_ids, vector_component, allocated, dims),
+                   int fsize,
+                   const ParArray3D<ParArray3D<T, VariableState>> &storage = {})
+      : VariablePack<T>(view, sparse_ids, vector_component, allocated, dims, storage),
         f_({f0, f1, f2}), flux_allocated_(flux_allocated), fsize_(fsize) {
     // don't check flux_allocation_status (see note in constructor of VariablePack)
     assert(fsize == f0.extent(0));
@@ -559,17 +565,38 @@ void AppendSparseBaseMap(const VariableVector<T> &vars, PackIndexMap *pvmap) {
   }
 }
 
+// Add the component ranges of vars, one after the other, to the index map of a pack
 template <typename T>
-void FillVarView(const VariableVector<T> &vars, int vsize, bool coarse,
-                 ViewOfParArrays<T> &cv_out, ParArray1D<int> &sparse_id_out,
-                 ParArray1D<int> &vector_component_out, ParArray1D<bool> &allocated_out,
-                 PackIndexMap *pvmap) {
+void FillIndexMap(const VariableVector<T> &vars, PackIndexMap *pvmap) {
   using vpack_types::IndexPair;
-  assert(vsize == cv_out.size() || 3 * vsize == cv_out.size());
+  if (pvmap == nullptr) return;
+
+  int vindex = 0;
+  for (const auto &v : vars) {
+    const int vstart = vindex;
+    vindex += v->NumComponents();
+
+    std::vector<int> shape;
+    auto mshape = v->metadata().Shape();
+    if (mshape.size() > 0) shape.push_back(v->GetDim(4));
+    if (mshape.size() > 1) shape.push_back(v->GetDim(5));
+    if (mshape.size() > 2) shape.push_back(v->GetDim(6));
+
+    pvmap->insert(v->label(), IndexPair(vstart, vindex - 1), shape);
+  }
+
+  AppendSparseBaseMap(vars, pvmap);
+}
+
+// Fill the per-component sparse ids, vector components, and allocation status of a pack
+// together with its index map, i.e. everything but the view of views
+template <typename T>
+void FillVarIndices(const VariableVector<T> &vars, int vsize,
+                    ParArray1D<int> &sparse_id_out, ParArray1D<int> &vector_component_out,
+                    ParArray1D<bool> &allocated_out, PackIndexMap *pvmap) {
   assert(vsize == sparse_id_out.size());
   assert(vsize == vector_component_out.size());
 
-  auto host_cv = Kokkos::create_mirror_view(Kokkos::HostSpace(), cv_out);
   auto host_sp = Kokkos::create_mirror_view(Kokkos::HostSpace(), sparse_id_out);
   auto host_vc = Kokkos::create_mirror_view(Kokkos::HostSpace(), vector_component_out);
   auto host_al = Kokkos::create_mirror_view(Kokkos::HostSpace(), allocated_out);
@@ -577,18 +604,43 @@ void FillVarView(const VariableVector<T> &vars, int vsize, bool coarse,
   int vindex = 0;
   for (const auto &v : vars) {
     int vstart = vindex;
+    for (int n = 0; n < v->NumComponents(); n++) {
+      host_sp(vindex) = v->GetSparseID();
+
+      // returns 1 for X1DIR, 2 for X2DIR, 3 for X3DIR
+      // for tensors, returns flattened index.
+      // for scalar-objects, returns NODIR.
+      const bool is_vec = v->IsSet(Metadata::Vector) || v->IsSet(Metadata::Tensor);
+      host_vc(vindex) = is_vec ? vindex - vstart + 1 : NODIR;
+
+      host_al(vindex) = v->IsAllocated();
+      vindex++;
+    }
+  }
+
+  FillIndexMap(vars, pvmap);
+
+  Kokkos::deep_copy(sparse_id_out, host_sp);
+  Kokkos::deep_copy(vector_component_out, host_vc);
+#ifdef ENABLE_SPARSE
+  Kokkos::deep_copy(allocated_out, host_al);
+#endif
+}
+
+template <typename T>
+void FillVarView(const VariableVector<T> &vars, int vsize, bool coarse,
+                 ViewOfParArrays<T> &cv_out, ParArray1D<int> &sparse_id_out,
+                 ParArray1D<int> &vector_component_out, ParArray1D<bool> &allocated_out,
+                 PackIndexMap *pvmap) {
+  assert(vsize == cv_out.size() || 3 * vsize == cv_out.size());
+
+  auto host_cv = Kokkos::create_mirror_view(Kokkos::HostSpace(), cv_out);
+
+  int vindex = 0;
+  for (const auto &v : vars) {
     for (int k = 0; k < v->GetDim(6); k++) {
       for (int j = 0; j < v->GetDim(5); j++) {
         for (int i = 0; i < v->GetDim(4); i++) {
-          host_sp(vindex) = v->GetSparseID();
-
-          // returns 1 for X1DIR, 2 for X2DIR, 3 for X3DIR
-          // for tensors, returns flattened index.
-          // for scalar-objects, returns NODIR.
-          const bool is_vec = v->IsSet(Metadata::Vector) || v->IsSet(Metadata::Tensor);
-          host_vc(vindex) = is_vec ? vindex - vstart + 1 : NODIR;
-
-          host_al(vindex) = v->IsAllocated();
           if (v->IsAllocated()) {
             if (v->IsSet(Metadata::Face) || v->IsSet(Metadata::Edge)) {
               host_cv(vindex) =
@@ -598,34 +650,18 @@ void FillVarView(const VariableVector<T> &vars, int vsize, bool coarse,
               host_cv(vindex + 2 * vsize) =
                   coarse ? v->coarse_s.Get(2, k, j, i) : v->data.Get(2, k, j, i);
             } else {
-              host_cv(vindex) =
-                  coarse ? v->coarse_s.Get(0, k, j, i) : v->data.Get(0, k, j, i);
+              host_cv(vindex) = v->GetComponent(k, j, i, coarse);
             }
           }
           vindex++;
         }
       }
     }
-
-    std::vector<int> shape;
-    auto mshape = v->metadata().Shape();
-    if (mshape.size() > 0) shape.push_back(v->GetDim(4));
-    if (mshape.size() > 1) shape.push_back(v->GetDim(5));
-    if (mshape.size() > 2) shape.push_back(v->GetDim(6));
-
-    if (pvmap != nullptr) {
-      pvmap->insert(v->label(), IndexPair(vstart, vindex - 1), shape);
-    }
   }
 
-  AppendSparseBaseMap(vars, pvmap);
-
   Kokkos::deep_copy(cv_out, host_cv);
-  Kokkos::deep_copy(sparse_id_out, host_sp);
-  Kokkos::deep_copy(vector_component_out, host_vc);
-#ifdef ENABLE_SPARSE
-  Kokkos::deep_copy(allocated_out, host_al);
-#endif
+
+  FillVarIndices(vars, vsize, sparse_id_out, vector_component_out, allocated_out, pvmap);
 }
 
 template <typename T>
@@ -667,25 +703,41 @@ void FillSwarmVarView(const vpack_types::SwarmVarList<T> &vars,
   Kokkos::deep_copy(cv_out, host_cv);
 }
 
+// Fill the allocation status of the fluxes of a pack and add them to its index map
+template <typename T>
+void FillFluxIndices(const VariableVector<T> &vars, ParArray1D<bool> &flux_allocated_out,
+                     PackIndexMap *pvmap) {
+  auto host_al = Kokkos::create_mirror_view(Kokkos::HostSpace(), flux_allocated_out);
+
+  int vindex = 0;
+  for (const auto &v : vars) {
+    for (int n = 0; n < v->NumComponents(); n++) {
+      host_al(vindex) = v->IsAllocated();
+      vindex++;
+    }
+  }
+
+  FillIndexMap(vars, pvmap);
+
+#ifdef ENABLE_SPARSE
+  Kokkos::deep_copy(flux_allocated_out, host_al);
+#endif
+}
+
 template <typename T>
 void FillFluxViews(const VariableVector<T> &vars, const int ndim,
                    ViewOfParArrays<T> &f1_out, ViewOfParArrays<T> &f2_out,
                    ViewOfParArrays<T> &f3_out, ParArray1D<bool> &flux_allocated_out,
                    PackIndexMap *pvmap) {
-  using vpack_types::IndexPair;
-
   auto host_f1 = Kokkos::create_mirror_view(Kokkos::HostSpace(), f1_out);
   auto host_f2 = Kokkos::create_mirror_view(Kokkos::HostSpace(), f2_out);
   auto host_f3 = Kokkos::create_mirror_view(Kokkos::HostSpace(), f3_out);
-  auto host_al = Kokkos::create_mirror_view(Kokkos::HostSpace(), flux_allocated_out);
 
   int vindex = 0;
   for (const auto &v : vars) {
-    int vstart = vindex;
     for (int k = 0; k < v->GetDim(6); k++) {
       for (int j = 0; j < v->GetDim(5); j++) {
         for (int i = 0; i < v->GetDim(4); i++) {
-          host_al(vindex) = v->IsAllocated();
           if (v->IsAllocated()) {
             if (v->IsSet(Metadata::Edge)) {
               if (ndim >= 2) host_f3(vindex) = v->data.Get(2, k, j, i);
@@ -702,32 +754,46 @@ void FillFluxViews(const VariableVector<T> &vars, const int ndim,
         }
       }
     }
-
-    std::vector<int> shape;
-    auto mshape = v->metadata().Shape();
-    if (mshape.size() > 0) shape.push_back(v->GetDim(4));
-    if (mshape.size() > 1) shape.push_back(v->GetDim(5));
-    if (mshape.size() > 2) shape.push_back(v->GetDim(6));
-
-    if (pvmap != nullptr) {
-      pvmap->insert(v->label(), IndexPair(vstart, vindex - 1), shape);
-    }
   }
 
-  AppendSparseBaseMap(vars, pvmap);
-
   Kokkos::deep_copy(f1_out, host_f1);
   Kokkos::deep_copy(f2_out, host_f2);
   Kokkos::deep_copy(f3_out, host_f3);
-#ifdef ENABLE_SPARSE
-  Kokkos::deep_copy(flux_allocated_out, host_al);
-#endif
+
+  FillFluxIndices(vars, flux_allocated_out, pvmap);
 }
 
+// Storage of a single block SparsePack that legacy packs over the same variables can be
+// windows into. The index arrays only depend on the variables, so they are filled by the
+// first legacy pack using the storage and shared by all later ones.
 template <typename T>
-VariableFluxPack<T> MakeFluxPack(const VarListWithKeys<T> &var_list,
-                                 const VarListWithKeys<T> &flux_var_list,
-                                 PackIndexMap *pvmap) {
+struct SparsePackStorage {
+  ParArray3D<ParArray3D<T, VariableState>> views;
+  ParArray1D<int> sparse_id;
+  ParArray1D<int> vector_component;
+  ParArray1D<bool> allocated;
+  ParArray1D<bool> flux_allocated;
+};
+
+// Unmanaged window [offset, offset + n) into the view of views of a single block
+// SparsePack. Packs hold on to the storage to keep it alive.
+template <typename T>
+ViewOfParArrays<T>
+WindowOfParArrays(const ParArray3D<ParArray3D<T, VariableState>> &storage, int offset,
+                  int n) {
+  using view_t = Kokkos::View<ParArray3D<T, VariableState> *, LayoutWrapper, DevMemSpace>;
+  assert(storage.extent_int(1) == 1);
+  assert(offset + n <= storage.size());
+  return ViewOfParArrays<T>(view_t(storage.data() + offset, n));
+}
+
+// If storage is not null, it holds a SparsePack with fluxes over exactly the variables in
+// var_list (each of which has its flux in the same position in flux_var_list), so the
+// pack becomes a window into it instead of a copy.
+template <typename T>
+VariableFluxPack<T>
+MakeFluxPack(const VarListWithKeys<T> &var_list, const VarListWithKeys<T> &flux_var_list,
+             PackIndexMap *pvmap, SparsePackStorage<T> *storage = nullptr) {
   const auto &vars = var_list.vars();           // for convenience
   const auto &flux_vars = flux_var_list.vars(); // for convenience
 
@@ -753,15 +819,48 @@ VariableFluxPack<T> MakeFluxPack(const VarListWithKeys<T> &var_list,
     fsize += v->NumComponents();
   }
 
+  const bool shared = (storage != nullptr) && (vsize > 0);
+  PARTHENON_REQUIRE(!shared || (!extra_components && fsize == vsize),
+                    "Face and edge fields cannot share their flux pack storage.");
+
   // make the outer view
-  ViewOfParArrays<T> cv("MakeFluxPack::cv", vsize * (extra_components ? 3 : 1));
-  ViewOfParArrays<T> f1("MakeFluxPack::f1", fsize);
-  ViewOfParArrays<T> f2("MakeFluxPack::f2", fsize);
-  ViewOfParArrays<T> f3("MakeFluxPack::f3", fsize);
-  ParArray1D<bool> flux_allocated("MakePack::allocated", fsize);
-  ParArray1D<int> sparse_id("MakeFluxPack::sparse_id", vsize);
-  ParArray1D<int> vector_component("MakeFluxPack::vector_component", vsize);
-  ParArray1D<bool> allocated("MakePack::allocated", vsize);
+  ViewOfParArrays<T> cv, f1, f2, f3;
+  ParArray3D<ParArray3D<T, VariableState>> views;
+  ParArray1D<bool> flux_allocated;
+  ParArray1D<int> sparse_id;
+  ParArray1D<int> vector_component;
+  ParArray1D<bool> allocated;
+  if (shared) {
+    // SparsePack layout is (type, block, component) with the fluxes as types 1 to 3
+    views = storage->views;
+    cv = WindowOfParArrays(storage->views, 0, vsize);
+    f1 = WindowOfParArrays(storage->views, vsize, fsize);
+    f2 = WindowOfParArrays(storage->views, 2 * vsize, fsize);
+    f3 = WindowOfParArrays(storage->views, 3 * vsize, fsize);
+    if (storage->flux_allocated.size() == 0) {
+      storage->flux_allocated = ParArray1D<bool>("MakePack::allocated", fsize);
+      storage->sparse_id = ParArray1D<int>("MakeFluxPack::sparse_id", vsize);
+      storage->vector_component =
+          ParArray1D<int>("MakeFluxPack::vector_component", vsize);
+      storage->allocated = ParArray1D<bool>("MakePack::allocated", vsize);
+      FillVarIndices(vars, vsize, storage->sparse_id, storage->vector_component,
+                     storage->allocated, nullptr);
+      FillFluxIndices(flux_vars, storage->flux_allocated, nullptr);
+    }
+    flux_allocated = storage->flux_allocated;
+    sparse_id = storage->sparse_id;
+    vector_component = storage->vector_component;
+    allocated = storage->allocated;
+  } else {
+    cv = ViewOfParArrays<T>("MakeFluxPack::cv", vsize * (extra_components ? 3 : 1));
+    f1 = ViewOfParArrays<T>("MakeFluxPack::f1", fsize);
+    f2 = ViewOfParArrays<T>("MakeFluxPack::f2", fsize);
+    f3 = ViewOfParArrays<T>("MakeFluxPack::f3", fsize);
+    flux_allocated = ParArray1D<bool>("MakePack::allocated", fsize);
+    sparse_id = ParArray1D<int>("MakeFluxPack::sparse_id", vsize);
+    vector_component = ParArray1D<int>("MakeFluxPack::vector_component", vsize);
+    allocated = ParArray1D<bool>("MakePack::allocated", vsize);
+  }
 
   std::array<int, 4> cv_size{0, 0, 0, 0};
   if (vsize > 0) {
@@ -773,22 +872,29 @@ VariableFluxPack<T> MakeFluxPack(const VarListWithKeys<T> &var_list,
     }
     cv_size[3] = vsize;
 
-    FillVarView(vars, vsize, false, cv, sparse_id, vector_component, allocated, pvmap);
+    if (shared) {
+      FillIndexMap(vars, pvmap);
+      FillIndexMap(flux_vars, pvmap);
+    } else {
+      FillVarView(vars, vsize, false, cv, sparse_id, vector_component, allocated, pvmap);
 
-    if (fsize > 0) {
-      // add fluxes
-      const int ndim = (cv_size[2] > 1 ? 3 : (cv_size[1] > 1 ? 2 : 1));
-      FillFluxViews(flux_vars, ndim, f1, f2, f3, flux_allocated, pvmap);
+      if (fsize > 0) {
+        // add fluxes
+        const int ndim = (cv_size[2] > 1 ? 3 : (cv_size[1] > 1 ? 2 : 1));
+        FillFluxViews(flux_vars, ndim, f1, f2, f3, flux_allocated, pvmap);
+      }
     }
   }
 
   return VariableFluxPack<T>(cv, f1, f2, f3, flux_allocated, sparse_id, vector_component,
-                             allocated, cv_size, fsize);
+                             allocated, cv_size, fsize, views);
 }
 
+// If storage is not null, it holds a SparsePack over exactly the variables in var_list,
+// so the pack becomes a window into it instead of a copy.
 template <typename T>
 VariablePack<T> MakePack(const VarListWithKeys<T> &var_list, bool coarse,
-                         PackIndexMap *pvmap) {
+                         PackIndexMap *pvmap, SparsePackStorage<T> *storage = nullptr) {
   const auto &vars = var_list.vars(); // for convenience
 
   if (vars.empty()) {
@@ -807,11 +913,35 @@ VariablePack<T> MakePack(const VarListWithKeys<T> &var_list, bool coarse,
         extra_components || v->IsSet(Metadata::Face) || v->IsSet(Metadata::Edge);
   }
 
+  const bool shared = (storage != nullptr) && (vsize > 0);
+
   // make the outer view
-  ViewOfParArrays<T> cv("MakePack::cv", vsize * (extra_components ? 3 : 1));
-  ParArray1D<int> sparse_id("MakePack::sparse_id", vsize);
-  ParArray1D<int> vector_component("MakePack::vector_component", vsize);
-  ParArray1D<bool> allocated("MakePack::allocated", vsize);
+  ViewOfParArrays<T> cv;
+  ParArray3D<ParArray3D<T, VariableState>> views;
+  ParArray1D<int> sparse_id;
+  ParArray1D<int> vector_component;
+  ParArray1D<bool> allocated;
+  if (shared) {
+    // Face and edge fields occupy types 0 to 2 of a SparsePack, which are contiguous
+    // just like the three element blocks of a legacy pack
+    views = storage->views;
+    cv = WindowOfParArrays(storage->views, 0, vsize * (extra_components ? 3 : 1));
+    if (storage->sparse_id.size() == 0) {
+      storage->sparse_id = ParArray1D<int>("MakePack::sparse_id", vsize);
+      storage->vector_component = ParArray1D<int>("MakePack::vector_component", vsize);
+      storage->allocated = ParArray1D<bool>("MakePack::allocated", vsize);
+      FillVarIndices(vars, vsize, storage->sparse_id, storage->vector_component,
+                     storage->allocated, nullptr);
+    }
+    sparse_id = storage->sparse_id;
+    vector_component = storage->vector_component;
+    allocated = storage->allocated;
+  } else {
+    cv = ViewOfParArrays<T>("MakePack::cv", vsize * (extra_components ? 3 : 1));
+    sparse_id = ParArray1D<int>("MakePack::sparse_id", vsize);
+    vector_component = ParArray1D<int>("MakePack::vector_component", vsize);
+    allocated = ParArray1D<bool>("MakePack::allocated", vsize);
+  }
 
   std::array<int, 4> cv_size{0, 0, 0, 0};
   if (vsize > 0) {
@@ -823,10 +953,15 @@ VariablePack<T> MakePack(const VarListWithKeys<T> &var_list, bool coarse,
     }
     cv_size[3] = vsize;
 
-    FillVarView(vars, vsize, coarse, cv, sparse_id, vector_component, allocated, pvmap);
+    if (shared) {
+      FillIndexMap(vars, pvmap);
+    } else {
+      FillVarView(vars, vsize, coarse, cv, sparse_id, vector_component, allocated,
+                  pvmap);
+    }
   }
 
-  return VariablePack<T>(cv, sparse_id, vector_component, allocated, cv_size);
+  return VariablePack<T>(cv, sparse_id, vector_component, allocated, cv_size, views);
 }
 
 template <typename T>
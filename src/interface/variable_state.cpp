@@ -28,6 +28,7 @@ VariableState::VariableState(const Metadata &md, int sparse_id,
   tensor_shape[2] = dims[5];
   tensor_components = tensor_shape[0] * tensor_shape[1] * tensor_shape[2];
   topological_type = GetTopologicalType(md);
+  if (md.IsSet(Metadata::ComponentInnermost)) i_stride = tensor_components;
 }
 
 } // namespace parthenon
@@ -66,6 +66,16 @@ struct VariableState : public empty_state_t {
   TopologicalElement topological_element = TopologicalElement::CC;
   std::size_t tensor_components;
   std::size_t tensor_shape[3];
+  // Distance between neighboring cells in x1 and position of the first cell in x1 of a
+  // pack entry. For variables with Metadata::ComponentInnermost, every pack entry holds
+  // the whole array with x1 fused with the components, i_stride is the number of
+  // components and i_offset is the component, so that cell i of the entry is at
+  // (k, j, StorageI(i)). Pack accessors taking cell indices apply this mapping.
+  int i_stride = 1;
+  int i_offset = 0;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  int StorageI(const int i) const { return i_stride * i + i_offset; }
 };
 
 } // namespace parthenon
@@ -18,6 +18,7 @@
 #include <memory>
 #include <set>
 #include <stack>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -295,5 +296,101 @@ Forest Forest::Make2D(ForestDefinition &forest_def) {
   return fout;
 }
 
+Forest Forest::Make3D(ForestDefinition &forest_def) {
+  PARTHENON_REQUIRE(forest_def.faces.empty(),
+                    "A forest can't contain both two and three dimensional trees.");
+  auto &cells = forest_def.cells;
+  // Set the topological connections of the cells
+  for (auto &cell : cells)
+    cell->SetNeighbors();
+  for (auto &cell : cells)
+    cell->SetFaceCoordinateTransforms();
+  // Transformations across edges are composed from those across faces, and
+  // transformations across nodes from those across faces and edges, so each needs a
+  // separate sweep
+  for (int nshared : {2, 1}) {
+    for (auto &cell : cells)
+      cell->SetComposedCoordinateTransforms(nshared);
+  }
+
+  using tree_bc_t = std::array<BoundaryFlag, BOUNDARY_NFACES>;
+  std::unordered_map<int64_t, tree_bc_t> tree_bcs;
+  for (auto &cell : cells) {
+    tree_bc_t bcs;
+    bcs.fill(BoundaryFlag::undef);
+    // Set the boundaries that are shared with other trees
+    for (int dir = 0; dir < 3; ++dir) {
+      for (int side : {-1, 1}) {
+        std::array<int, 3> ox{0, 0, 0};
+        ox[dir] = side;
+        if (cell->HasNeighbor(ox[0], ox[1], ox[2]))
+          bcs[CellCentOffsets(ox).Face()] = BoundaryFlag::block;
+      }
+    }
+    tree_bcs[cell->GetId()] = bcs;
+  }
+
+  // Set the user specified boundary conditions
+  for (auto &bc_face : forest_def.bc_faces) {
+    for (auto &node : bc_face.element) {
+      for (auto &cell : node->associated_cells) {
+        auto opt_offset = cell->IsFace(bc_face.element);
+        if (opt_offset) tree_bcs[cell->GetId()][opt_offset->Face()] = bc_face.bflag;
+      }
+    }
+  }
+
+  // Build the list of trees and set neighbors
+  std::unordered_map<std::int64_t, std::shared_ptr<Tree>> trees;
+  for (int c = 0; c < cells.size(); ++c) {
+    const auto &cell = cells[c];
+    const auto &cell_size = forest_def.cell_sizes[c];
+    auto &bcs = tree_bcs[cell->GetId()];
+    for (auto bf : bcs)
+      PARTHENON_REQUIRE(bf != BoundaryFlag::undef,
+                        "Every face of tree " + std::to_string(cell->GetId()) +
+                            " must be shared with another tree or have a boundary "
+                            "condition.");
+    RegionSize tree_domain = forest_def.block_size;
+    for (auto dir : {X1DIR, X2DIR, X3DIR}) {
+      tree_domain.xmin(dir) = cell_size.xmin(dir);
+      tree_domain.xmax(dir) = cell_size.xmax(dir);
+    }
+    trees[cell->GetId()] =
+        Tree::create(cell->GetId(), 3, 0, tree_domain, bcs, cell->nodes);
+  }
+
+  bool rotated = false;
+  for (const auto &cell : cells) {
+    Indexer3D offsets({-1, 1}, {-1, 1}, {-1, 1});
+    for (int o = 0; o < offsets.size(); ++o) {
+      auto [ox1, ox2, ox3] = offsets(o);
+      for (auto &[neighbor, ct] : cell->neighbors(ox1, ox2, ox3)) {
+        trees[cell->GetId()]->AddNeighborTree(CellCentOffsets(ox1, ox2, ox3),
+                                              trees[neighbor->GetId()], ct, false);
+        for (int dir = 0; dir < 3; ++dir)
+          rotated = rotated || ct.dir_connection[dir] != dir || ct.dir_flip[dir];
+      }
+    }
+  }
+  // Indices are permuted when communicating between rotated trees
+  const auto &bs = forest_def.block_size;
+  PARTHENON_REQUIRE(!rotated || (bs.nx(X1DIR) == bs.nx(X2DIR) &&
+                                 bs.nx(X1DIR) == bs.nx(X3DIR)),
+                    "Forests with rotated trees require cubic blocks.");
+
+  Forest fout;
+  fout.root_level = 0;
+  fout.forest_level = 0;
+  for (auto &[id, tree] : trees)
+    fout.AddTree(tree);
+
+  // Add requested refinement to base forest
+  for (const auto &loc : forest_def.refinement_locations)
+    fout.AddMeshBlock(loc);
+
+  return fout;
+}
+
 } // namespace forest
 } // namespace parthenon
@@ -47,10 +47,13 @@ class ForestDefinition {
  protected:
   friend class Forest;
   std::vector<std::shared_ptr<Face>> faces;
+  std::vector<std::shared_ptr<Cell>> cells;
   RegionSize block_size;
   std::vector<ForestBC<Edge>> bc_edges;
+  std::vector<ForestBC<sptr_vec_t<Node, 4>>> bc_faces;
   std::vector<LogicalLocation> refinement_locations;
   std::vector<RegionSize> face_sizes;
+  std::vector<RegionSize> cell_sizes;
 
  public:
   using ar3_t = std::array<Real, 3>;
@@ -61,6 +64,13 @@ class ForestDefinition {
     face_sizes.emplace_back(xmin, xmax, ar3_t{1.0, 1.0, 1.0}, ai3_t{1, 1, 1});
   }
 
+  // Add a hexahedral tree to a three dimensional forest, see Cell for the node ordering
+  void AddCell(std::size_t id, std::array<std::shared_ptr<Node>, 8> nodes_in,
+               ar3_t xmin = {0.0, 0.0, 0.0}, ar3_t xmax = {1.0, 1.0, 1.0}) {
+    cells.emplace_back(Cell::create(id, nodes_in));
+    cell_sizes.emplace_back(xmin, xmax, ar3_t{1.0, 1.0, 1.0}, ai3_t{1, 1, 1});
+  }
+
   void AddBC(Edge edge, BoundaryFlag bf, std::optional<Edge> periodic_connection = {}) {
     if (bf == BoundaryFlag::periodic)
       PARTHENON_REQUIRE(periodic_connection,
@@ -68,11 +78,21 @@ class ForestDefinition {
     bc_edges.emplace_back(ForestBC<Edge>{edge, bf, periodic_connection});
   }
 
+  // Set the boundary condition on the face of a three dimensional forest defined by the
+  // four face_nodes. Periodicity is encoded by sharing nodes between cells instead.
+  void AddBC(sptr_vec_t<Node, 4> face_nodes, BoundaryFlag bf) {
+    PARTHENON_REQUIRE(bf != BoundaryFlag::periodic,
+                      "Periodic faces must be connected through shared nodes.");
+    bc_faces.emplace_back(ForestBC<sptr_vec_t<Node, 4>>{face_nodes, bf, {}});
+  }
+
   void AddInitialRefinement(const LogicalLocation &loc) {
     refinement_locations.push_back(loc);
   }
 
   void SetBlockSize(const RegionSize &bs) { block_size = bs; }
+
+  int NumDimensions() const { return cells.empty() ? 2 : 3; }
 };
 
 class Forest {
@@ -217,6 +237,9 @@ class Forest {
                                  std::array<BoundaryFlag, BOUNDARY_NFACES> mesh_bcs);
 
   static Forest Make2D(ForestDefinition &forest_def);
+
+  // Build a forest of hexahedral trees with arbitrary connectivity, e.g. a cubed sphere
+  static Forest Make3D(ForestDefinition &forest_def);
 };
 
 } // namespace forest
@@ -30,9 +30,11 @@ namespace parthenon {
 namespace forest {
 
 class Face;
+class Cell;
 class Node {
  public:
-  Node(int id_in, std::array<Real, NDIM> pos) : id(id_in), x(pos), associated_faces{} {}
+  Node(int id_in, std::array<Real, NDIM> pos)
+      : id(id_in), x(pos), associated_faces{}, associated_cells{} {}
 
   static std::shared_ptr<Node> create(int id, std::array<Real, NDIM> pos) {
     return std::make_shared<Node>(id, pos);
@@ -41,6 +43,7 @@ class Node {
   std::uint32_t id;
   std::array<Real, NDIM> x;
   std::unordered_set<std::shared_ptr<Face>> associated_faces;
+  std::unordered_set<std::shared_ptr<Cell>> associated_cells;
 };
 } // namespace forest
 } // namespace parthenon
@@ -17,6 +17,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -171,5 +172,124 @@ void Face::SetNodeCoordinateTransforms() {
   }
 }
 
+void Cell::SetNeighbors() {
+  std::unordered_set<std::shared_ptr<Cell>> neighbors_local;
+  for (auto &node : nodes)
+    neighbors_local.insert(node->associated_cells.begin(), node->associated_cells.end());
+  for (std::shared_ptr<Cell> neighbor : neighbors_local) {
+    auto node_overlap = NodeListOverlap(nodes, neighbor->nodes);
+    if (node_overlap.size() > 0 && node_overlap.size() < 8) {
+      std::array<int, 3> offset{0, 0, 0};
+      for (auto &node : node_overlap) {
+        for (int o = 0; o < 3; ++o)
+          offset[o] += static_cast<int>(node_to_offset[cell_index[node]][o]);
+      }
+      for (auto &o : offset)
+        o /= static_cast<int>(node_overlap.size());
+      CellCentOffsets ox(offset);
+      // A shared face has four nodes, a shared edge two and a shared node one
+      const int ndir = std::abs(offset[0]) + std::abs(offset[1]) + std::abs(offset[2]);
+      PARTHENON_REQUIRE(static_cast<int>(node_overlap.size()) == (1 << (3 - ndir)),
+                        "The nodes shared by cells " + std::to_string(GetId()) + " and " +
+                            std::to_string(neighbor->GetId()) +
+                            " are not a face, an edge, or a node.");
+      neighbors(offset[0], offset[1], offset[2])
+          .push_back(std::make_pair(neighbor, LogicalCoordinateTransformation()));
+      neighbors_to_offsets[neighbor] = ox;
+    }
+  }
+}
+
+LogicalCoordinateTransformation &
+Cell::GetTransform(const std::shared_ptr<Cell> &neighbor) {
+  const std::array<int, 3> ox = neighbors_to_offsets.at(neighbor);
+  for (auto &[n, ct] : neighbors(ox[0], ox[1], ox[2])) {
+    if (n == neighbor) return ct;
+  }
+  PARTHENON_FAIL("Cell is not a neighbor.");
+  return neighbors(ox[0], ox[1], ox[2])[0].second;
+}
+
+void Cell::SetFaceCoordinateTransforms() {
+  for (auto &[neighbor, ox] : neighbors_to_offsets) {
+    if (!ox.IsFace()) continue;
+    const auto &ox_neigh = neighbor->neighbors_to_offsets.at(getptr());
+    const int dir = ox.GetNormals()[0].first - 1;
+    const int dir_neigh = ox_neigh.GetNormals()[0].first - 1;
+
+    LogicalCoordinateTransformation ct;
+    // The normal direction continues into the neighbor, unless the shared face is on the
+    // same side of both cells
+    ct.SetDirection(static_cast<CoordinateDirection>(dir + 1),
+                    static_cast<CoordinateDirection>(dir_neigh + 1),
+                    ox[dir] == ox_neigh[dir_neigh]);
+    // The directions tangent to the face are found by following an edge of the shared
+    // face in each direction, which runs along some direction of the neighbor
+    for (int d = 0; d < 3; ++d) {
+      if (d == dir) continue;
+      for (int n = 0; n < 8; ++n) {
+        if (((n >> d) & 1) || !neighbor->cell_index.count(nodes[n])) continue;
+        const auto &low = node_to_offset[neighbor->cell_index.at(nodes[n])];
+        const auto &up = node_to_offset[neighbor->cell_index.at(nodes[n | (1 << d)])];
+        for (int d_neigh = 0; d_neigh < 3; ++d_neigh) {
+          const int diff = static_cast<int>(up[d_neigh]) - static_cast<int>(low[d_neigh]);
+          if (diff != 0)
+            ct.SetDirection(static_cast<CoordinateDirection>(d + 1),
+                            static_cast<CoordinateDirection>(d_neigh + 1), diff < 0);
+        }
+        break;
+      }
+    }
+    ct.offset = ox;
+    ct.use_offset = true;
+    GetTransform(neighbor) = ct;
+  }
+}
+
+void Cell::SetComposedCoordinateTransforms(int nshared) {
+  for (auto &[neighbor, ox] : neighbors_to_offsets) {
+    auto node_overlap = NodeListOverlap(nodes, neighbor->nodes);
+    if (static_cast<int>(node_overlap.size()) != nshared) continue;
+    bool found = false;
+    // Look for a cell that contains the shared edge or node and shares more nodes with
+    // both this cell and the neighbor, so that both transformations to it are known
+    for (auto &shared : node_overlap[0]->associated_cells) {
+      if (!neighbors_to_offsets.count(shared) ||
+          !shared->neighbors_to_offsets.count(neighbor))
+        continue;
+      const int nshared_edge = NodeListOverlap(node_overlap, shared->nodes).size();
+      const int nshared_this = NodeListOverlap(nodes, shared->nodes).size();
+      const int nshared_neigh = NodeListOverlap(shared->nodes, neighbor->nodes).size();
+      if (nshared_edge != nshared || nshared_this <= nshared || nshared_neigh <= nshared)
+        continue;
+      auto ct =
+          ComposeTransformations(GetTransform(shared), shared->GetTransform(neighbor));
+      ct.offset = ox;
+      ct.use_offset = true;
+      GetTransform(neighbor) = ct;
+      found = true;
+      break;
+    }
+    PARTHENON_REQUIRE(found, "Could not find the coordinate transformation from cell " +
+                                 std::to_string(GetId()) + " to cell " +
+                                 std::to_string(neighbor->GetId()) + ".");
+  }
+}
+
+std::optional<CellCentOffsets> Cell::IsFace(const sptr_vec_t<Node, 4> &face_nodes) {
+  auto node_overlap = NodeListOverlap(nodes, face_nodes);
+  if (node_overlap.size() != 4) return {};
+  std::array<int, 3> offset{0, 0, 0};
+  for (auto &node : node_overlap) {
+    for (int o = 0; o < 3; ++o)
+      offset[o] += static_cast<int>(node_to_offset[cell_index[node]][o]);
+  }
+  for (auto &o : offset)
+    o /= 4;
+  CellCentOffsets ox(offset);
+  if (!ox.IsFace()) return {};
+  return ox;
+}
+
 } // namespace forest
 } // namespace parthenon
@@ -124,6 +124,69 @@ class Face : public std::enable_shared_from_this<Face> {
       CellCentOffsets{1, 1, -1}};
 };
 
+// A hexahedral tree of a three dimensional forest. Its eight nodes are ordered like the
+// daughters of a LogicalLocation, i.e. node n sits at the low (high) side of direction
+// d if bit d of n is zero (one). Neighboring cells are found through shared nodes, and
+// the logical coordinate transformations to neighbors across faces are determined by
+// the node correspondence. Transformations to edge and node neighbors are built by
+// composing the transformations through a cell that shares the same edge or node.
+class Cell : public std::enable_shared_from_this<Cell> {
+ private:
+  struct private_t {};
+
+ public:
+  Cell() = default;
+
+  // Constructor that can only be called internally
+  Cell(std::int64_t id, sptr_vec_t<Node, 8> nodes_in, private_t)
+      : my_id(id), nodes(nodes_in) {
+    int idx{0};
+    for (auto &node : nodes)
+      cell_index[node] = idx++;
+  }
+
+  static std::shared_ptr<Cell> create(std::int64_t id, sptr_vec_t<Node, 8> nodes_in) {
+    auto result = std::make_shared<Cell>(id, nodes_in, private_t());
+    // Associate the new cell with the nodes
+    for (auto &node : result->nodes)
+      node->associated_cells.insert(result);
+    return result;
+  }
+
+  std::int64_t GetId() const { return my_id; }
+
+  void SetNeighbors();
+  void SetFaceCoordinateTransforms();
+  // Set the transformations to neighbors that share nshared nodes, which requires the
+  // transformations to all neighbors sharing more nodes to be set on every cell
+  void SetComposedCoordinateTransforms(int nshared);
+  bool HasNeighbor(int ox1, int ox2, int ox3) {
+    return neighbors(ox1, ox2, ox3).size() > 0;
+  }
+
+  // Offsets of the face of this cell defined by the four face_nodes, if there is one
+  std::optional<CellCentOffsets> IsFace(const sptr_vec_t<Node, 4> &face_nodes);
+
+  std::shared_ptr<Cell> getptr() { return shared_from_this(); }
+
+  std::int64_t my_id{-1};
+
+  sptr_vec_t<Node, 8> nodes;
+  std::unordered_map<std::shared_ptr<Node>, int> cell_index;
+
+  NeighborInfo<std::pair<std::shared_ptr<Cell>, LogicalCoordinateTransformation>>
+      neighbors;
+  std::unordered_map<std::shared_ptr<Cell>, CellCentOffsets> neighbors_to_offsets;
+
+  static constexpr std::array<CellCentOffsets, 8> node_to_offset = {
+      CellCentOffsets{-1, -1, -1}, CellCentOffsets{1, -1, -1}, CellCentOffsets{-1, 1, -1},
+      CellCentOffsets{1, 1, -1},   CellCentOffsets{-1, -1, 1}, CellCentOffsets{1, -1, 1},
+      CellCentOffsets{-1, 1, 1},   CellCentOffsets{1, 1, 1}};
+
+ private:
+  LogicalCoordinateTransformation &GetTransform(const std::shared_ptr<Cell> &neighbor);
+};
+
 // We choose face nodes to be ordered as:
 //
 //   2---3
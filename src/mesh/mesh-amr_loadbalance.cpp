@@ -105,10 +105,12 @@ bool TryRecvCoarseToFine(int lid_recv, int send_rank, const LogicalLocation &fin
                                    send_rank, tag, comm, MPI_STATUS_IGNORE));
       fb = var->data;
 #endif
-      auto cb = var->coarse_s;
-      const int nt = fb.GetDim(6) - 1;
-      const int nu = fb.GetDim(5) - 1;
-      const int nv = fb.GetDim(4) - 1;
+      // Index the arrays as (element, t, u, v, k, j, i) independent of their layout
+      auto fbl = var->GetLogicalView(fb);
+      auto cb = var->GetLogicalView(var->coarse_s, true);
+      const int nt = fbl.GetDim(6) - 1;
+      const int nu = fbl.GetDim(5) - 1;
+      const int nv = fbl.GetDim(4) - 1;
 
       auto &cellbounds = var->IsSet(Metadata::Fine) ? pmb->f_cellbounds : pmb->cellbounds;
       auto &c_cellbounds =
@@ -130,7 +132,7 @@ bool TryRecvCoarseToFine(int lid_recv, int send_rank, const LogicalLocation &fin
             PARTHENON_AUTO_LABEL, 0, nt, 0, nu, 0, nv, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
             KOKKOS_LAMBDA(const int t, const int u, const int v, const int k, const int j,
                           const int i) {
-              cb(idx_te, t, u, v, k, j, i) = fb(idx_te, t, u, v, k + ks, j + js, i + is);
+              cb(idx_te, t, u, v, k, j, i) = fbl(idx_te, t, u, v, k + ks, j + js, i + is);
             });
       }
     } else {
@@ -199,7 +201,9 @@ bool TryRecvFineToCoarse(int lid_recv, int send_rank, const LogicalLocation &fin
                                    MPI_STATUS_IGNORE));
       cb = var->coarse_s;
 #endif
-      auto fb = var->data;
+      // Index the arrays as (element, t, u, v, k, j, i) independent of their layout
+      auto cbl = var->GetLogicalView(cb, true);
+      auto fb = var->GetLogicalView(var->data);
       const int nt = fb.GetDim(6) - 1;
       const int nu = fb.GetDim(5) - 1;
       const int nv = fb.GetDim(4) - 1;
@@ -227,7 +231,7 @@ bool TryRecvFineToCoarse(int lid_recv, int send_rank, const LogicalLocation &fin
             PARTHENON_AUTO_LABEL, 0, nt, 0, nu, 0, nv, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
             KOKKOS_LAMBDA(const int t, const int u, const int v, const int k, const int j,
                           const int i) {
-              fb(idx_te, t, u, v, k + ks, j + js, i + is) = cb(idx_te, t, u, v, k, j, i);
+              fb(idx_te, t, u, v, k + ks, j + js, i + is) = cbl(idx_te, t, u, v, k, j, i);
             });
       }
       // We have to block here w/o buffering so that the write is guaranteed to be
@@ -322,6 +326,7 @@ bool TryRecvSameToSame(int lid_recv, int send_rank, Variable<Real> *var, MeshBlo
 void Mesh::LoadBalancingAndAdaptiveMeshRefinement(ParameterInput *pin,
                                                   ApplicationInput *app_in) {
   PARTHENON_INSTRUMENT
+  remesh_schedule_.AddCycle(remesh_timer_.seconds());
   int nnew = 0, ndel = 0;
 
   if (adaptive) {
@@ -330,40 +335,74 @@ void Mesh::LoadBalancingAndAdaptiveMeshRefinement(ParameterInput *pin,
     nbdel += ndel;
   }
 
-  lb_flag_ |= lb_automatic_;
+  lb_flag_ |= lb_automatic_ || lb_measure_rank_weights_;
 
   UpdateCostList();
 
   modified = false;
   if (nnew != 0 || ndel != 0) { // at least one (de)refinement happened
     GatherCostListAndCheckBalance();
-    RedistributeAndRefineMeshBlocks(pin, app_in, nbtotal + nnew - ndel);
-    modified = true;
+    RemeshAndMeasureCost_(pin, app_in, nbtotal + nnew - ndel);
   } else if (lb_flag_ && step_since_lb >= lb_interval_) {
     if (!GatherCostListAndCheckBalance()) { // load imbalance detected
-      RedistributeAndRefineMeshBlocks(pin, app_in, nbtotal);
-      modified = true;
+      if (remesh_schedule_.RebalanceIsWorthwhile(lb_imbalance_)) {
+        RemeshAndMeasureCost_(pin, app_in, nbtotal);
+      } else {
+        // Skip the balance checks, and their global communication, until the imbalance
+        // could have cost more than a remesh
+        const int ncycles =
+            remesh_schedule_.CyclesUntilRebalanceIsWorthwhile(lb_imbalance_);
+        step_since_lb = std::min(0, lb_interval_ - ncycles);
+      }
     }
     lb_flag_ = false;
   }
+  remesh_timer_.reset();
+}
+
+//----------------------------------------------------------------------------------------
+// \!fn void Mesh::RemeshAndMeasureCost_(ParameterInput *pin, int ntot)
+// \brief redistribute MeshBlocks and record the cost of doing so for the scheduling of
+// later remeshes
+
+void Mesh::RemeshAndMeasureCost_(ParameterInput *pin, ApplicationInput *app_in,
+                                 int ntot) {
+  Kokkos::Timer timer;
+  RedistributeAndRefineMeshBlocks(pin, app_in, ntot);
+  modified = true;
+  double times[2] = {0.0, 0.0};
+  if (remesh_schedule_.Enabled()) {
+    Kokkos::fence();
+    times[0] = timer.seconds();
+    times[1] = remesh_schedule_.LocalComputeTimePerCycle();
+#ifdef MPI_PARALLEL
+    PARTHENON_MPI_CHECK(
+        MPI_Allreduce(MPI_IN_PLACE, times, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD));
+#endif
+  }
+  remesh_schedule_.SetCosts(times[0], times[1]);
 }
 
 // Private routines
 namespace {
 /**
  * @brief This routine assigns blocks to ranks by attempting to place index-contiguous
- * blocks of equal total cost on each rank.
+ * blocks on each rank with a total cost proportional to the capacity of the rank.
  *
  * @param costlist (Input) A map of global block ID to a relative weight.
+ * @param rank_weights (Input) The relative capacity of each rank.
  * @param ranklist (Output) A map of global block ID to ranks.
  */
-void AssignBlocks(std::vector<double> const &costlist, std::vector<int> &ranklist) {
+void AssignBlocks(std::vector<double> const &costlist,
+                  std::vector<double> const &rank_weights, std::vector<int> &ranklist) {
   ranklist.resize(costlist.size());
 
   double const total_cost = std::accumulate(costlist.begin(), costlist.end(), 0.0);
+  double remaining_weight =
+      std::accumulate(rank_weights.begin(), rank_weights.end(), 0.0);
 
   int rank = (Globals::nranks)-1;
-  double target_cost = total_cost / Globals::nranks;
+  double target_cost = total_cost * rank_weights[rank] / remaining_weight;
   double my_cost = 0.0;
   double remaining_cost = total_cost;
   // create rank list from the end: the master MPI rank should have less load
@@ -378,10 +417,11 @@ void AssignBlocks(std::vector<double> const &costlist, std::vector<int> &ranklis
     my_cost += costlist[block_id];
     ranklist[block_id] = rank;
     if (my_cost >= target_cost && rank > 0) {
+      remaining_weight -= rank_weights[rank];
       rank--;
       remaining_cost -= my_cost;
       my_cost = 0.0;
-      target_cost = remaining_cost / (rank + 1);
+      target_cost = remaining_cost * rank_weights[rank] / remaining_weight;
     }
   }
 }
@@ -417,8 +457,8 @@ void Mesh::CalculateLoadBalance(std::vector<double> const &costlist,
   double const mincost = min_max.first == costlist.begin() ? 0.0 : *min_max.first;
   double const maxcost = min_max.second == costlist.begin() ? 0.0 : *min_max.second;
 
-  // Assigns blocks to ranks on a rougly cost-equal basis.
-  AssignBlocks(costlist, ranklist);
+  // Assigns blocks to ranks on a rougly cost-equal basis, scaled by the rank capacities.
+  AssignBlocks(costlist, rank_weights_, ranklist);
 
   // Updates nslist with the ID of the starting block on each rank and the count of blocks
   // on each rank.
@@ -524,6 +564,9 @@ void Mesh::UpdateMeshBlockTree(int &nnew, int &ndel) {
   if (tnref == 0 && tnderef < nleaf) { // nothing to do
     return;
   }
+  // Refinement is required for accuracy and is never deferred, while blocks flagged for
+  // derefinement only are derefined together with a later remesh
+  if (tnref == 0 && remesh_schedule_.DeferDerefinement()) return;
 
   int rd = 0, dd = 0;
   for (int n = 0; n < Globals::nranks; n++) {
@@ -629,23 +672,27 @@ void Mesh::UpdateMeshBlockTree(int &nnew, int &ndel) {
 // \brief collect the cost from MeshBlocks and check the load balance
 
 bool Mesh::GatherCostListAndCheckBalance() {
-  if (lb_manual_ || lb_automatic_) {
+  if (lb_measure_rank_weights_) MeasureRankWeights_();
+  if (lb_manual_ || lb_automatic_ || lb_measure_rank_weights_) {
 #ifdef MPI_PARALLEL
     PARTHENON_MPI_CHECK(MPI_Allgatherv(MPI_IN_PLACE, nblist[Globals::my_rank], MPI_DOUBLE,
                                        costlist.data(), nblist.data(), nslist.data(),
                                        MPI_DOUBLE, MPI_COMM_WORLD));
 #endif
-    double maxcost = 0.0, avecost = 0.0;
+    // compare costs relative to the capacity of each rank
+    double maxcost = 0.0, avecost = 0.0, totweight = 0.0;
     for (int rank = 0; rank < Globals::nranks; rank++) {
       double rcost = 0.0;
       int ns = nslist[rank];
       int ne = ns + nblist[rank];
       for (int n = ns; n < ne; ++n)
         rcost += costlist[n];
-      maxcost = std::max(maxcost, rcost);
+      maxcost = std::max(maxcost, rcost / rank_weights_[rank]);
       avecost += rcost;
+      totweight += rank_weights_[rank];
     }
-    avecost /= Globals::nranks;
+    avecost /= totweight;
+    if (avecost > 0.0) lb_imbalance_ = maxcost / avecost;
 
     if (adaptive)
       lb_tolerance_ =
@@ -656,6 +703,34 @@ bool Mesh::GatherCostListAndCheckBalance() {
   return true;
 }
 
+//----------------------------------------------------------------------------------------
+// \!fn void Mesh::MeasureRankWeights_()
+// \brief set the rank capacities to the cost of the blocks on each rank per time spent
+// in tasks since the last measurement
+
+void Mesh::MeasureRankWeights_() {
+  double rcost = 0.0;
+  for (auto const &pmb : block_list) {
+    rcost += costlist[pmb->gid];
+  }
+  const double busy_time = Globals::task_busy_time_sec - task_busy_time_at_measurement_;
+  task_busy_time_at_measurement_ = Globals::task_busy_time_sec;
+
+  std::vector<double> throughput(Globals::nranks, 0.0);
+  throughput[Globals::my_rank] = (busy_time > 0.0) ? rcost / busy_time : 0.0;
+#ifdef MPI_PARALLEL
+  PARTHENON_MPI_CHECK(MPI_Allgather(MPI_IN_PLACE, 1, MPI_DOUBLE, throughput.data(), 1,
+                                    MPI_DOUBLE, MPI_COMM_WORLD));
+#endif
+  // keep the previous capacities if some rank has not executed any task since then
+  if (*std::min_element(throughput.begin(), throughput.end()) <= 0.0) return;
+  const double mean = std::accumulate(throughput.begin(), throughput.end(), 0.0) /
+                      static_cast<double>(Globals::nranks);
+  for (int rank = 0; rank < Globals::nranks; rank++) {
+    rank_weights_[rank] = throughput[rank] / mean;
+  }
+}
+
 //----------------------------------------------------------------------------------------
 // \!fn void Mesh::RedistributeAndRefineMeshBlocks(ParameterInput *pin, int ntot)
 // \brief redistribute MeshBlocks according to the new load balance
@@ -929,6 +1004,9 @@ void Mesh::RedistributeAndRefineMeshBlocks(ParameterInput *pin, ApplicationInput
     }
     refinement::ProlongateShared(resolved_packages.get(), prolongation_cache,
                                  block_list[0]->cellbounds, block_list[0]->c_cellbounds);
+    // Prolongation runs on the default execution space instance, but MeshData partitions
+    // may work on the new blocks from other instances
+    Kokkos::fence();
 
     // update the lists
     loclist = std::move(newloc);
@@ -981,6 +1059,7 @@ void Mesh::RedistributeAndRefineMeshBlocks(ParameterInput *pin, ApplicationInput
       refinement::ProlongateInternal(resolved_packages.get(), prolongation_cache,
                                      block_list[0]->cellbounds,
                                      block_list[0]->c_cellbounds);
+      Kokkos::fence();
     }
 
     // Rebuild just the ownership model, this time weighting the "new" fine blocks just
@@ -55,6 +55,9 @@ void Mesh::SetMeshBlockNeighbors(
     std::vector<NeighborBlock> all_neighbors;
     const auto &loc = pmb->loc;
     auto neighbors = forest.FindNeighbors(loc, grid_id);
+    // Ownership of this block, which neighbors also compute to mask what they receive
+    auto origin_ownership = DetermineOwnership(loc, neighbors, newly_refined);
+    origin_ownership.initialized = true;
 
     // Build NeighborBlocks for unique neighbors
     for (const auto &nloc : neighbors) {
@@ -81,6 +84,7 @@ void Mesh::SetMeshBlockNeighbors(
       nb.ownership =
           DetermineOwnership(nloc.global_loc, neighbor_neighbors, newly_refined);
       nb.ownership.initialized = true;
+      nb.origin_ownership = origin_ownership;
 
       // Set logical coordinate transformation from this block to the neighbor
       nb.lcoord_trans = nloc.lcoord_trans;
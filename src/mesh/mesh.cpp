@@ -25,7 +25,9 @@
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -75,6 +77,7 @@ Mesh::Mesh(ParameterInput *pin, ApplicationInput *app_in, Packages_t &packages,
       nbnew(), nbdel(), step_since_lb(), gflag(), packages(packages),
       resolved_packages(ResolvePackages(packages)),
       default_pack_size_(pin->GetOrAddInteger("parthenon/mesh", "pack_size", -1)),
+      pack_by_level_(pin->GetOrAddBoolean("parthenon/mesh", "pack_by_level", false)),
       // private members:
       num_mesh_threads_(pin->GetOrAddInteger("parthenon/mesh", "num_threads", 1)),
       use_uniform_meshgen_fn_{true, true, true, true}, lb_flag_(true), lb_automatic_(),
@@ -123,6 +126,26 @@ Mesh::Mesh(ParameterInput *pin, ApplicationInput *app_in, Packages_t &packages,
     max_level = 63;
   }
 
+  // Independent MeshData partitions get their own execution space instances so
+  // that their kernels and host-device copies can overlap
+  const int num_instances =
+      pin->GetOrAddInteger("parthenon/mesh", "num_exec_space_instances", 1);
+  PARTHENON_REQUIRE_THROWS(num_instances > 0,
+                           "parthenon/mesh/num_exec_space_instances must be positive");
+  if (num_instances > 1) {
+    exec_space_instances_ = Kokkos::Experimental::partition_space(
+        DevExecSpace(), std::vector<int>(num_instances, 1));
+  } else {
+    exec_space_instances_ = {DevExecSpace()};
+  }
+
+  combine_flux_corrections_ =
+      pin->GetOrAddBoolean("parthenon/mesh", "combine_flux_corrections", false);
+
+  remesh_schedule_ =
+      RemeshSchedule(pin->GetOrAddReal("parthenon/mesh", "remesh_cost_fraction", 0.0),
+                     pin->GetOrAddInteger("parthenon/mesh", "remesh_max_defer", 100));
+
   SetupMPIComms();
 
   RegisterLoadBalancing_(pin);
@@ -189,8 +212,9 @@ Mesh::Mesh(ParameterInput *pin, ApplicationInput *app_in, Packages_t &packages,
 Mesh::Mesh(ParameterInput *pin, ApplicationInput *app_in, Packages_t &packages,
            forest::ForestDefinition &forest_def)
     : Mesh(pin, app_in, packages, base_constructor_selector_t()) {
-  mesh_size =
-      RegionSize({0, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 1, 1}, {false, false, true});
+  const bool three_d = forest_def.NumDimensions() == 3;
+  mesh_size = RegionSize({0, 0, 0}, {1, 1, three_d ? 1.0 : 0.0}, {1, 1, 1}, {1, 1, 1},
+                         {false, false, !three_d});
   mesh_bcs = {
       GetBoundaryFlag(pin->GetOrAddString("parthenon/mesh", "ix1_bc", "reflecting")),
       GetBoundaryFlag(pin->GetOrAddString("parthenon/mesh", "ox1_bc", "reflecting")),
@@ -211,9 +235,10 @@ Mesh::Mesh(ParameterInput *pin, ApplicationInput *app_in, Packages_t &packages,
   }
   forest_def.SetBlockSize(base_block_size);
 
-  ndim = 2;
+  ndim = forest_def.NumDimensions();
   // Load balancing flag and parameters
-  forest = forest::Forest::Make2D(forest_def);
+  forest = three_d ? forest::Forest::Make3D(forest_def)
+                   : forest::Forest::Make2D(forest_def);
   root_level = forest.root_level;
   forest.EnrollBndryFncts(app_in, resolved_packages->UserBoundaryFunctions,
                           resolved_packages->UserSwarmBoundaryFunctions);
@@ -395,17 +420,84 @@ Mesh::~Mesh() {
 //  \brief Partition a given block list for use by MeshData
 
 void Mesh::BuildBlockPartitions(GridIdentifier grid) {
-  auto partition_blocklists = partition::ToSizeN(
-      grid.type == GridType::leaf ? block_list : gmg_block_lists[grid.logical_level],
-      DefaultPackSize());
+  auto &blocks =
+      grid.type == GridType::leaf ? block_list : gmg_block_lists[grid.logical_level];
+  partition::Partition_t<std::shared_ptr<MeshBlock>> partition_blocklists;
+  if (pack_by_level_ && grid.type == GridType::leaf) {
+    // Blocks are in Morton order within each tree, so consecutive blocks of the same
+    // level are spatially close. Each level is split into partitions of similar size
+    // that are at most DefaultPackSize() large.
+    std::map<int, BlockList_t> level_lists;
+    for (auto &pmb : blocks)
+      level_lists[pmb->loc.level()].push_back(pmb);
+    for (auto &[level, level_list] : level_lists) {
+      const int npartitions =
+          partition::partition_impl::IntCeil(level_list.size(), DefaultPackSize());
+      auto level_partitions = partition::ToNPartitions(level_list, npartitions);
+      partition_blocklists.insert(partition_blocklists.end(),
+                                  std::make_move_iterator(level_partitions.begin()),
+                                  std::make_move_iterator(level_partitions.end()));
+    }
+  } else {
+    partition_blocklists = partition::ToSizeN(blocks, DefaultPackSize());
+  }
   // Account for possibly empty block_list
   if (partition_blocklists.size() == 0)
     partition_blocklists = std::vector<BlockList_t>(1);
   std::vector<std::shared_ptr<BlockListPartition>> out;
   int id = 0;
-  for (auto &part_bl : partition_blocklists)
-    out.emplace_back(std::make_shared<BlockListPartition>(id++, grid, part_bl, this));
+  for (auto &part_bl : partition_blocklists) {
+    auto exec_space = GetExecSpaceInstance(id);
+    // Blocks on the leaf grid launch their per-block kernels on the same instance
+    // as the partition they belong to, so that work on a block stays ordered
+    if (grid.type == GridType::leaf) {
+      for (auto &pmb : part_bl)
+        pmb->exec_space = exec_space;
+    }
+    out.emplace_back(
+        std::make_shared<BlockListPartition>(id++, grid, part_bl, this, exec_space));
+  }
   block_partitions_[grid] = out;
+
+  if (grid.type == GridType::leaf) {
+    // Any estimates stored for the previous partitioning are stale, they are
+    // recomputed by the driver after a remesh
+    const int npkgs = std::max<int>(1, packages.AllPackages().size());
+    num_dt_estimate_partitions_ = out.size();
+    device_dt_estimates_ =
+        ParArray1D<Real>("device dt estimates", num_dt_estimate_partitions_ * npkgs);
+    Kokkos::deep_copy(device_dt_estimates_, std::numeric_limits<Real>::max());
+  }
+}
+
+ParArray0D<Real> Mesh::GetDeviceDtEstimate(int partition, int ipkg) const {
+  PARTHENON_DEBUG_REQUIRE(HasDeviceDtEstimate(partition),
+                          "No device timestep estimate for this partition.");
+  const int npkgs = std::max<int>(1, packages.AllPackages().size());
+  return ParArray0D<Real>(
+      Kokkos::subview(device_dt_estimates_.KokkosView(), partition * npkgs + ipkg));
+}
+
+//----------------------------------------------------------------------------------------
+//  \brief Combine the device-side timestep estimates of all partitions with a single
+//  reduction and transfer, resetting them for the next cycle
+
+Real Mesh::ReduceDeviceDtEstimates() {
+  PARTHENON_INSTRUMENT
+  // Estimates may have been written on any of the partitions' execution space instances
+  if (NumExecSpaceInstances() > 1) Kokkos::fence();
+  auto dt_estimates = device_dt_estimates_;
+  const Real big = std::numeric_limits<Real>::max();
+  Real dt_min = big;
+  par_reduce(
+      loop_pattern_flatrange_tag, PARTHENON_AUTO_LABEL, DevExecSpace(), 0,
+      dt_estimates.extent_int(0) - 1,
+      KOKKOS_LAMBDA(const int n, Real &lmin) {
+        lmin = dt_estimates(n) < lmin ? dt_estimates(n) : lmin;
+        dt_estimates(n) = big;
+      },
+      Kokkos::Min<Real>(dt_min));
+  return dt_min;
 }
 
 //----------------------------------------------------------------------------------------
@@ -579,6 +671,27 @@ void Mesh::ApplyUserWorkBeforeRestartOutput(Mesh *mesh, ParameterInput *pin,
   }
 }
 
+buf_pool_t<Real> &Mesh::GetBufferPool(int buf_size) {
+  std::lock_guard<std::mutex> lock(pool_map_mutex_);
+  auto it = pool_map.find(buf_size);
+  if (it == pool_map.end()) {
+    it = pool_map
+             .emplace(buf_size, buf_pool_t<Real>([buf_size](buf_pool_t<Real> *pool) {
+               using buf_t = buf_pool_t<Real>::base_t;
+               // TODO(LFR): Make nbuf a user settable parameter
+               const int nbuf = 200;
+               buf_t chunk("pool buffer", buf_size * nbuf);
+               for (int i = 1; i < nbuf; ++i) {
+                 pool->AddFreeObjectToPool(
+                     buf_t(chunk, std::make_pair(i * buf_size, (i + 1) * buf_size)));
+               }
+               return buf_t(chunk, std::make_pair(0, buf_size));
+             }))
+             .first;
+  }
+  return it->second;
+}
+
 void Mesh::BuildTagMapAndBoundaryBuffers() {
   const int num_partitions = DefaultNumPartitions();
   const int nmb = GetNumMeshBlocksThisRank(Globals::my_rank);
@@ -611,6 +724,11 @@ void Mesh::BuildTagMapAndBoundaryBuffers() {
     auto &pmb = block_list[i];
     pmb->meshblock_data.Get()->GetSwarmData()->SetupPersistentMPI();
   }
+  for (auto &pair : resolved_packages->AllSwarms()) {
+    auto &termination = swarm_comm_termination_[pair.first];
+    if (termination == nullptr) termination = std::make_shared<SwarmCommTermination>();
+    termination->SetNumBlocks(nmb);
+  }
 
   // Wait for boundary buffers to be no longer in use
   bool can_delete;
@@ -901,6 +1019,7 @@ const IndexShape &Mesh::GetLeafBlockCellBounds(CellLevel level) const {
 
 // Functionality re-used in mesh constructor
 void Mesh::RegisterLoadBalancing_(ParameterInput *pin) {
+  rank_weights_ = std::vector<double>(Globals::nranks, 1.0);
 #ifdef MPI_PARALLEL // JMM: Not sure this ifdef is needed
   const std::string balancer =
       pin->GetOrAddString("parthenon/loadbalancing", "balancer", "default",
@@ -917,6 +1036,19 @@ void Mesh::RegisterLoadBalancing_(ParameterInput *pin) {
   }
   lb_tolerance_ = pin->GetOrAddReal("parthenon/loadbalancing", "tolerance", 0.5);
   lb_interval_ = pin->GetOrAddInteger("parthenon/loadbalancing", "interval", 10);
+
+  if (pin->DoesParameterExist("parthenon/loadbalancing", "rank_weights")) {
+    const auto weights = pin->GetVector<Real>("parthenon/loadbalancing", "rank_weights");
+    rank_weights_.assign(weights.begin(), weights.end());
+    PARTHENON_REQUIRE_THROWS(
+        rank_weights_.size() == static_cast<std::size_t>(Globals::nranks),
+        "Number of rank_weights must match the number of ranks");
+    for (const auto w : rank_weights_) {
+      PARTHENON_REQUIRE_THROWS(w > 0.0, "rank_weights must be positive");
+    }
+  }
+  lb_measure_rank_weights_ =
+      pin->GetOrAddBoolean("parthenon/loadbalancing", "measure_rank_weights", false);
 #endif // MPI_PARALLEL
 }
 
@@ -940,6 +1072,12 @@ void Mesh::SetupMPIComms() {
       PARTHENON_REQUIRE_THROWS(ret.second, "Communicator with same name already in map");
     }
   }
+  if (combine_flux_corrections_) {
+    MPI_Comm mpi_comm;
+    PARTHENON_MPI_CHECK(MPI_Comm_dup(MPI_COMM_WORLD, &mpi_comm));
+    const auto ret = mpi_comm_map_.insert({combined_flxcor_label, mpi_comm});
+    PARTHENON_REQUIRE_THROWS(ret.second, "Communicator with same name already in map");
+  }
   for (auto &pair : resolved_packages->AllSwarms()) {
     MPI_Comm mpi_comm;
     PARTHENON_MPI_CHECK(MPI_Comm_dup(MPI_COMM_WORLD, &mpi_comm));
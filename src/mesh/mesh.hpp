@@ -26,6 +26,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -44,10 +45,12 @@
 #include "interface/data_collection.hpp"
 #include "interface/mesh_data.hpp"
 #include "interface/state_descriptor.hpp"
+#include "interface/swarm_comm_termination.hpp"
 #include "kokkos_abstraction.hpp"
 #include "mesh/forest/forest.hpp"
 #include "mesh/forest/forest_topology.hpp"
 #include "mesh/meshblock_pack.hpp"
+#include "mesh/remesh_schedule.hpp"
 #include "outputs/io_wrapper.hpp"
 #include "parameter_input.hpp"
 #include "parthenon_arrays.hpp"
@@ -146,6 +149,9 @@ class Mesh {
     return default_pack_size_ < 1 ? block_list.size() : default_pack_size_;
   }
   int DefaultNumPartitions() {
+    // Partitioning by level can give more partitions than blocks divided by pack size
+    auto it = block_partitions_.find(GridIdentifier::leaf());
+    if (pack_by_level_ && it != block_partitions_.end()) return it->second.size();
     return partition::partition_impl::IntCeil(block_list.size(), DefaultPackSize());
   }
 
@@ -154,6 +160,25 @@ class Mesh {
     return block_partitions_.at(grid);
   }
 
+  // Whether dense flux correction variables share one message per boundary
+  bool CombineFluxCorrections() const { return combine_flux_corrections_; }
+
+  // Execution space instances are handed out round-robin to MeshData partitions so
+  // that work on independent partitions can overlap
+  int NumExecSpaceInstances() const { return exec_space_instances_.size(); }
+  DevExecSpace GetExecSpaceInstance(int partition) const {
+    return exec_space_instances_[partition % exec_space_instances_.size()];
+  }
+
+  // Timestep estimates of packages providing EstimateTimestepMeshOnDevice are kept on
+  // device, one slot per (leaf grid partition, package), and only combined and brought
+  // back to the host once per cycle
+  bool HasDeviceDtEstimate(int partition) const {
+    return partition >= 0 && partition < num_dt_estimate_partitions_;
+  }
+  ParArray0D<Real> GetDeviceDtEstimate(int partition, int ipkg) const;
+  Real ReduceDeviceDtEstimates();
+
   // step 7: create new MeshBlock list (same MPI rank but diff level: create new block)
   // Moved here given Cuda/nvcc restriction:
   // "error: The enclosing parent function ("...")
@@ -219,6 +244,9 @@ class Mesh {
   using channel_key_t = std::tuple<int, int, std::string, int, int>;
   using comm_buf_t = CommBuffer<buf_pool_t<Real>::owner_t>;
   std::unordered_map<int, buf_pool_t<Real>> pool_map;
+  // Pool of communication buffers of size buf_size, which is created if it does not
+  // exist yet. Pools are never removed, so the returned reference stays valid.
+  buf_pool_t<Real> &GetBufferPool(int buf_size);
   using comm_buf_map_t =
       std::unordered_map<channel_key_t, comm_buf_t, tuple_hash<channel_key_t>>;
   comm_buf_map_t boundary_comm_map;
@@ -228,6 +256,11 @@ class Mesh {
   MPI_Comm GetMPIComm(const std::string &label) const { return mpi_comm_map_.at(label); }
 #endif
 
+  // termination detection of the iterative exchange of the swarm with the given label
+  SwarmCommTermination &GetSwarmCommTermination(const std::string &label) {
+    return *swarm_comm_termination_.at(label);
+  }
+
   void SetAllVariablesToInitialized() {
     for (auto &sp_mb : block_list) {
       for (auto &pair : sp_mb->meshblock_data.Stages()) {
@@ -238,6 +271,7 @@ class Mesh {
   }
 
   uint64_t GetBufferPoolSizeInBytes() const {
+    std::lock_guard<std::mutex> lock(pool_map_mutex_);
     std::uint64_t buffer_memory = 0;
     for (auto &p : pool_map) {
       buffer_memory += p.second.SizeInBytes();
@@ -284,12 +318,42 @@ class Mesh {
   bool lb_flag_, lb_automatic_, lb_manual_;
   double lb_tolerance_;
   int lb_interval_;
+  // ratio of the maximum to the average cost per rank in the last balance check
+  double lb_imbalance_ = 1.0;
+  // relative capacity of each rank, either set by the user or measured from the time
+  // spent in tasks per cost of the blocks on the rank
+  std::vector<double> rank_weights_;
+  bool lb_measure_rank_weights_ = false;
+  double task_busy_time_at_measurement_ = 0.0;
+
+  // cost-aware remesh scheduling
+  RemeshSchedule remesh_schedule_;
+  Kokkos::Timer remesh_timer_;
 
   // size of default MeshBlockPacks
   int default_pack_size_;
+  // whether the blocks of a default MeshBlockPack all have the same level
+  bool pack_by_level_;
+
+  // execution space instances used by MeshData partitions
+  std::vector<DevExecSpace> exec_space_instances_;
+
+  // send flux corrections of all dense variables in a single message per boundary
+  bool combine_flux_corrections_;
+
+  // device-side timestep estimates of the leaf grid partitions
+  ParArray1D<Real> device_dt_estimates_;
+  int num_dt_estimate_partitions_ = 0;
 
   int gmg_min_logical_level_ = 0;
 
+  // Guards pool_map, which can be extended while tasks acquire buffers from its pools
+  mutable std::mutex pool_map_mutex_;
+
+  // Shared by the blocks of this rank, one per swarm
+  std::unordered_map<std::string, std::shared_ptr<SwarmCommTermination>>
+      swarm_comm_termination_;
+
 #ifdef MPI_PARALLEL
   // Global map of MPI comms for separate variables
   std::unordered_map<std::string, MPI_Comm> mpi_comm_map_;
@@ -310,6 +374,8 @@ class Mesh {
   void UpdateCostList();
   void UpdateMeshBlockTree(int &nnew, int &ndel);
   bool GatherCostListAndCheckBalance();
+  void MeasureRankWeights_();
+  void RemeshAndMeasureCost_(ParameterInput *pin, ApplicationInput *app_in, int ntot);
   void RedistributeAndRefineMeshBlocks(ParameterInput *pin, ApplicationInput *app_in,
                                        int ntot);
   void BuildGMGBlockLists(ParameterInput *pin, ApplicationInput *app_in);
@@ -462,12 +462,15 @@ class MeshBlock : public std::enable_shared_from_this<MeshBlock> {
 using BlockList_t = std::vector<std::shared_ptr<MeshBlock>>;
 
 struct BlockListPartition {
-  BlockListPartition(int p, GridIdentifier g, const BlockList_t &bl, Mesh *pm)
-      : partition{p}, grid{g}, block_list{bl}, pmesh{pm} {}
+  BlockListPartition(int p, GridIdentifier g, const BlockList_t &bl, Mesh *pm,
+                     DevExecSpace es = DevExecSpace())
+      : partition{p}, grid{g}, block_list{bl}, pmesh{pm}, exec_space{es} {}
   const int partition;
   const GridIdentifier grid;
   const BlockList_t block_list;
   Mesh *pmesh;
+  // Execution space instance that kernels on this partition are launched on
+  const DevExecSpace exec_space;
 };
 
 } // namespace parthenon
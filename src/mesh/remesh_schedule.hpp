@@ -0,0 +1,103 @@
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+#ifndef MESH_REMESH_SCHEDULE_HPP_
+#define MESH_REMESH_SCHEDULE_HPP_
+//! \file remesh_schedule.hpp
+//  \brief decides when a remesh is worth its measured cost
+
+#include <algorithm>
+#include <cmath>
+
+namespace parthenon {
+
+//----------------------------------------------------------------------------------------
+//! \class RemeshSchedule
+//  \brief Tracks the cost of remeshing and the time spent computing since the last
+//  remesh. The decisions only depend on the measured times passed to SetCosts, which
+//  must be the same on all ranks, and on the number of cycles since the last remesh.
+//  A cost fraction of zero disables the scheduling and nothing is ever deferred.
+
+class RemeshSchedule {
+ public:
+  RemeshSchedule() = default;
+  RemeshSchedule(double cost_fraction, int max_defer)
+      : cost_fraction_(cost_fraction), max_defer_(max_defer) {}
+
+  bool Enabled() const { return cost_fraction_ > 0.0; }
+  int CyclesSinceRemesh() const { return cycles_since_remesh_; }
+
+  // Record a cycle that spent seconds computing on this rank
+  void AddCycle(double seconds) {
+    compute_time_since_remesh_ += seconds;
+    cycles_since_remesh_++;
+  }
+  // Wall time per cycle on this rank since the last remesh
+  double LocalComputeTimePerCycle() const {
+    return compute_time_since_remesh_ / std::max(cycles_since_remesh_, 1);
+  }
+  // Record a remesh, given the maxima over ranks of its wall time and of the wall time
+  // per cycle before it
+  void SetCosts(double remesh_time, double compute_time_per_cycle) {
+    remesh_time_ = remesh_time;
+    compute_time_per_cycle_ = compute_time_per_cycle;
+    cycles_since_remesh_ = 0;
+    compute_time_since_remesh_ = 0.0;
+  }
+
+  // Whether blocks flagged for derefinement only are kept until enough time has been
+  // spent computing since the last remesh to amortize its cost
+  bool DeferDerefinement() const {
+    if (!Enabled() || cycles_since_remesh_ >= max_defer_) return false;
+    return cost_fraction_ * compute_time_per_cycle_ * cycles_since_remesh_ <
+           remesh_time_;
+  }
+
+  // Whether the time lost to a load imbalance, the ratio of the maximum to the average
+  // cost per rank, since the last remesh exceeds the cost of a remesh. Assumes the wall
+  // time of a cycle is set by the slowest rank.
+  bool RebalanceIsWorthwhile(double imbalance) const {
+    if (!Enabled() || cycles_since_remesh_ >= max_defer_) return true;
+    return LostTimePerCycle_(imbalance) * cycles_since_remesh_ >= remesh_time_;
+  }
+
+  // Number of cycles from now after which a rebalance becomes worthwhile if the
+  // imbalance stays the same. At least one and at most the cycles left until a remesh
+  // can no longer be deferred.
+  int CyclesUntilRebalanceIsWorthwhile(double imbalance) const {
+    if (RebalanceIsWorthwhile(imbalance)) return 0;
+    const int max_cycles = max_defer_ - cycles_since_remesh_;
+    const double lost_per_cycle = LostTimePerCycle_(imbalance);
+    if (lost_per_cycle <= 0.0) return max_cycles;
+    const double lost_time = lost_per_cycle * cycles_since_remesh_;
+    const double cycles = std::ceil((remesh_time_ - lost_time) / lost_per_cycle);
+    return std::max(1, static_cast<int>(std::min<double>(cycles, max_cycles)));
+  }
+
+ private:
+  double LostTimePerCycle_(double imbalance) const {
+    return (1.0 - 1.0 / imbalance) * compute_time_per_cycle_;
+  }
+
+  double cost_fraction_ = 0.0;
+  int max_defer_ = 0;
+  int cycles_since_remesh_ = 0;
+  double compute_time_since_remesh_ = 0.0;
+  // maximum over ranks of the wall time of the last remesh and of the wall time per
+  // cycle between the last two remeshes
+  double remesh_time_ = 0.0;
+  double compute_time_per_cycle_ = 0.0;
+};
+
+} // namespace parthenon
+
+#endif // MESH_REMESH_SCHEDULE_HPP_
@@ -178,12 +178,14 @@ void AscentOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, SimTime *tm,
       const auto var_info = VarInfo(var, bounds);
 
       for (int icomp = 0; icomp < var_info.num_components; ++icomp) {
-        auto const data = Kokkos::subview(var->data, 0, 0, icomp, Kokkos::ALL(),
-                                          Kokkos::ALL(), Kokkos::ALL());
+        auto const data = var->GetComponent(0, 0, icomp);
         const std::string varname = var_info.component_labels.at(icomp);
         mesh["fields/" + varname + "/association"] = "element";
         mesh["fields/" + varname + "/topology"] = "topo";
-        mesh["fields/" + varname + "/values"].set_external(data.data(), ncells);
+        // Components may be interleaved, see Metadata::ComponentInnermost
+        mesh["fields/" + varname + "/values"].set_external(
+            data.data(), ncells, data.i_offset * sizeof(Real),
+            data.i_stride * sizeof(Real));
       }
     }
   }
@@ -48,6 +48,7 @@ struct OutputParameters {
   bool include_ghost_zones, cartesian_vector;
   bool single_precision_output;
   bool sparse_seed_nans;
+  bool compact_sparse;
   int hdf5_compression_level;
   bool write_xdmf;
   bool write_swarm_xdmf;
@@ -56,7 +57,8 @@ struct OutputParameters {
       : block_number(0), next_time(0.0), dt(-1.0), file_number(0),
         include_ghost_zones(false), cartesian_vector(false),
         single_precision_output(false), sparse_seed_nans(false),
-        hdf5_compression_level(5), write_xdmf(false), write_swarm_xdmf(false) {}
+        compact_sparse(false), hdf5_compression_level(5), write_xdmf(false),
+        write_swarm_xdmf(false) {}
 };
 
 } // namespace parthenon
@@ -158,9 +158,11 @@ Outputs::Outputs(Mesh *pm, ParameterInput *pin, SimTime *tm) {
             pin->GetOrAddBoolean(op.block_name, "single_precision_output", false);
         op.sparse_seed_nans =
             pin->GetOrAddBoolean(op.block_name, "sparse_seed_nans", false);
+        op.compact_sparse = pin->GetOrAddBoolean(op.block_name, "compact_sparse", false);
       } else {
         op.single_precision_output = false;
         op.sparse_seed_nans = false;
+        op.compact_sparse = false;
 
         if (pin->DoesParameterExist(op.block_name, "single_precision_output")) {
           std::stringstream warn;
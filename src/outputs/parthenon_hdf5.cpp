@@ -284,6 +284,12 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
   // global block index and the second index is the sparse field (same order as the
   // SparseFields attribute). SparseInfo[b][v] is true if the sparse field with index
   // v is allocated on the block with index b, otherwise the value is false
+  //
+  // If compact_sparse is set, the datasets of sparse fields only contain the blocks on
+  // which they are allocated, in the order of the global block index. The row of block
+  // b in the dataset of sparse field v is then the number of blocks before b on which
+  // v is allocated, i.e. SparseInfo serves as the index of these datasets. This is
+  // marked by the attribute "CompactSparse" of SparseInfo.
 
   std::vector<std::string> sparse_names;
   std::unordered_map<std::string, size_t> sparse_field_idx;
@@ -350,6 +356,10 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
     }
 #endif
 
+    // only allocated blocks of sparse fields are written with compact_sparse
+    const bool compact = output_params.compact_sparse && vinfo.is_sparse;
+    hsize_t num_blocks_written = 0;
+
     // load up data
     hsize_t index = 0;
 
@@ -365,7 +375,9 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
         // For reference, if we update the logic here, there's also
         // a similar block in parthenon_manager.cpp
         if (v->IsAllocated() && (var_name == v->label())) {
-          auto v_h = v->data.GetHostMirrorAndCopy();
+          const auto v_mirror = v->data.GetHostMirrorAndCopy();
+          // Output is always ordered as (t, u, v, k, j, i) independent of the layout
+          const auto v_h = v->GetLogicalView(v_mirror);
           OutputUtils::PackOrUnpackVar(
               vinfo, output_params.include_ghost_zones, index,
               [&](auto index, int topo, int t, int u, int v, int k, int j, int i) {
@@ -373,6 +385,7 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
               });
           is_allocated = true;
           dealloc_count = v->dealloc_count;
+          num_blocks_written++;
           break;
         }
       }
@@ -384,7 +397,9 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
       }
 
       if (!is_allocated) {
-        if (vinfo.is_sparse) {
+        if (compact) {
+          continue;
+        } else if (vinfo.is_sparse) {
           hsize_t varSize = vinfo.FillSize(theDomain);
           auto fill_val =
               output_params.sparse_seed_nans ? std::numeric_limits<OutT>::quiet_NaN() : 0;
@@ -399,6 +414,18 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
     }
     Kokkos::Profiling::popRegion(); // fill host output buffer
 
+    if (compact) {
+      std::size_t num_blocks_total = 0;
+      local_offset[0] = OutputUtils::MPIPrefixSum(num_blocks_written, num_blocks_total);
+      local_count[0] = num_blocks_written;
+      global_count[0] = num_blocks_total;
+      // we can't write a zero-size dataset, and there is nothing to read back anyway
+      if (num_blocks_total == 0) {
+        Kokkos::Profiling::popRegion(); // write variable loop
+        continue;
+      }
+    }
+
     Kokkos::Profiling::pushRegion("write variable data");
     // write data to file
     { // scope so the dataset gets closed
@@ -555,7 +582,15 @@ void PHDF5Output::WriteOutputFileImpl(Mesh *pm, ParameterInput *pin, SimTime *tm
   if (output_params.write_xdmf || output_params.write_swarm_xdmf) {
     Kokkos::Profiling::pushRegion("genXDMF");
     // generate XDMF companion file
-    XDMF::genXDMF(filename, pm, tm, theDomain, nx1, nx2, nx3, all_vars_info, swarm_info,
+    // XDMF references variables by global block index, which does not work for sparse
+    // fields with compact storage, so these are left out
+    auto xdmf_vars_info = all_vars_info;
+    if (output_params.compact_sparse) {
+      xdmf_vars_info.erase(std::remove_if(xdmf_vars_info.begin(), xdmf_vars_info.end(),
+                                          [](const auto &v) { return v.is_sparse; }),
+                           xdmf_vars_info.end());
+    }
+    XDMF::genXDMF(filename, pm, tm, theDomain, nx1, nx2, nx3, xdmf_vars_info, swarm_info,
                   output_params.write_xdmf, output_params.write_swarm_xdmf);
     Kokkos::Profiling::popRegion(); // genXDMF
   }
@@ -736,6 +771,7 @@ void PHDF5Output::WriteSparseInfo_(Mesh *pm, hbool_t *sparse_allocated,
 
   const H5D dset = H5D::FromHIDCheck(H5Dopen2(file, "SparseInfo", H5P_DEFAULT));
   HDF5WriteAttribute("SparseFields", names, dset);
+  HDF5WriteAttribute("CompactSparse", output_params.compact_sparse ? 1 : 0, dset);
   Kokkos::Profiling::popRegion(); // write sparse info
 }
 
@@ -59,6 +59,10 @@ class RestartReader {
     int num_blocks = 0;
     int num_sparse = 0;
 
+    // whether the datasets of sparse fields only contain the blocks on which the fields
+    // are allocated
+    bool compact = false;
+
     bool IsAllocated(int block, int sparse_field_idx) const {
       PARTHENON_REQUIRE_THROWS(allocated != nullptr,
                                "Tried to get allocation status but no data present");
@@ -80,6 +84,18 @@ class RestartReader {
 
       return dealloc_count[block * num_sparse + sparse_field_idx];
     }
+
+    // Range of rows that the blocks in range occupy in the compact dataset of a sparse
+    // field, which is empty if the field is not allocated on any of these blocks
+    IndexRange CompactRows(const IndexRange &range, int sparse_field_idx) const {
+      int first = 0;
+      for (int b = 0; b < range.s; ++b)
+        first += IsAllocated(b, sparse_field_idx);
+      int last = first - 1;
+      for (int b = range.s; b <= range.e; ++b)
+        last += IsAllocated(b, sparse_field_idx);
+      return IndexRange{first, last};
+    }
   };
 
   [[nodiscard]] virtual SparseInfo GetSparseInfo() const = 0;
@@ -103,6 +103,13 @@ RestartReaderHDF5::SparseInfo RestartReaderHDF5::GetSparseInfo() const {
     // Read data from file
     PARTHENON_HDF5_CHECK(H5Dread(hdl.dataset, hdl.type, memspace, hdl.dataspace,
                                  H5P_DEFAULT, static_cast<void *>(info.allocated.get())));
+    // files written before compact sparse storage was available lack this attribute
+    const H5O obj = H5O::FromHIDCheck(H5Oopen(fh_, "SparseInfo", H5P_DEFAULT));
+    auto compact_status = PARTHENON_HDF5_CHECK(H5Aexists(obj, "CompactSparse"));
+    if (compact_status > 0) {
+      info.compact = GetAttr<int>("SparseInfo", "CompactSparse") != 0;
+    }
+
     info.dealloc_count.resize(hdl_dealloc.count);
     PARTHENON_HDF5_CHECK(H5Dread(hdl_dealloc.dataset, hdl_dealloc.type,
                                  H5S::FromHIDCheck(H5Screate_simple(
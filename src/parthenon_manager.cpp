@@ -332,9 +332,18 @@ void ParthenonManager::RestartPackages(Mesh &rm, RestartReader &resfile) {
     if (Globals::my_rank == 0) {
       std::cout << "Var: " << label << ":" << vlen << std::endl;
     }
-    // Read relevant data from the hdf file, this works for dense and sparse variables
+    // Read relevant data from the hdf file, this works for dense and sparse variables.
+    // With compact sparse storage only the allocated blocks are stored, so the rows of
+    // the blocks of this rank are looked up in the SparseInfo table.
+    const bool compact = v_info.is_sparse && sparse_info.compact;
+    IndexRange rows = myBlocks;
+    if (compact) {
+      rows = sparse_info.CompactRows(myBlocks, sparse_idxs.at(label));
+    }
     try {
-      resfile.ReadBlocks(label, myBlocks, v_info, tmp, file_output_format_ver);
+      if (rows.e >= rows.s) {
+        resfile.ReadBlocks(label, rows, v_info, tmp, file_output_format_ver);
+      }
     } catch (std::exception &ex) {
       std::cout << "[" << Globals::my_rank << "] WARNING: Failed to read variable "
                 << label << " from restart file:" << std::endl
@@ -353,14 +362,17 @@ void ParthenonManager::RestartPackages(Mesh &rm, RestartReader &resfile) {
           // stored in the restart files.
           pmb->meshblock_data.Get()->GetVarPtr(label)->dealloc_count = dealloc_count;
         } else {
-          // nothing to read for this block, advance reading index
-          index += nCells * vlen;
+          // nothing to read for this block, advance reading index unless only
+          // allocated blocks are stored
+          if (!compact) index += nCells * vlen;
           continue;
         }
       }
 
       auto v = pmb->meshblock_data.Get()->GetVarPtr(label);
-      auto v_h = v->data.GetHostMirror();
+      auto v_mirror = v->data.GetHostMirror();
+      // Files are always ordered as (t, u, v, k, j, i) independent of the layout
+      const auto v_h = v->GetLogicalView(v_mirror);
 
       // Double note that this also needs to be update in case
       // we update the HDF5 infrastructure!
@@ -377,7 +389,7 @@ void ParthenonManager::RestartPackages(Mesh &rm, RestartReader &resfile) {
         PARTHENON_THROW(msg)
       }
 
-      v->data.DeepCopy(v_h);
+      v->data.DeepCopy(v_mirror);
     }
   }
 
@@ -21,6 +21,7 @@
 #define PROLONG_RESTRICT_PR_LOOPS_HPP_
 
 #include <algorithm>
+#include <type_traits>
 #include <utility> // std::forward
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "globals.hpp"                 // for Globals
 #include "kokkos_abstraction.hpp"      // for ParArray
 #include "mesh/domain.hpp"             // for IndexShape
+#include "utils/error_checking.hpp"
 
 namespace parthenon {
 namespace refinement {
@@ -55,23 +57,78 @@ KOKKOS_FORCEINLINE_FUNCTION bool DoRefinementOp(const Info_t &info,
 // too large.
 //
 // There's a host version of the loop, which only requires buffer cache host,
-// a device version, which requires the buffer cache device only,
-// and a version that automatically swaps between them depending on
-// the size of the buffer cache.
+// and a device version, which requires the buffer cache device only. When
+// both are available, the device version is always used and, if there are
+// few buffers, each buffer is split over several teams so that a single
+// launch still fills the device.
 
+// Whether the stencil only writes elements of the same type as the coarse
+// element it iterates over. Only then are the iterations over different
+// coarse elements independent, so that a buffer can be split over teams.
+template <class Stencil>
+constexpr bool ActsOnSameElementOnly() {
+  using TE = TopologicalElement;
+  constexpr TE els[] = {TE::CC, TE::F1, TE::F2, TE::F3, TE::E1, TE::E2, TE::E3, TE::NN};
+  for (const auto fel : els) {
+    for (const auto cel : els) {
+      if (fel != cel && Stencil::OperationRequired(fel, cel)) return false;
+    }
+  }
+  return true;
+}
+
+// Whether the Do of the stencil is templated on the array type, so that it can be
+// passed the strided views of variables with Metadata::ComponentInnermost
+template <class Stencil, class = void>
+struct AcceptsStridedData : std::false_type {};
+template <class Stencil>
+struct AcceptsStridedData<
+    Stencil,
+    std::void_t<decltype(Stencil::template Do<1, TopologicalElement::CC,
+                                              TopologicalElement::CC>(
+        0, 0, 0, 0, 0, 0, std::declval<IndexRange>(), std::declval<IndexRange>(),
+        std::declval<IndexRange>(), std::declval<IndexRange>(),
+        std::declval<IndexRange>(), std::declval<IndexRange>(),
+        std::declval<Coordinates_t>(), std::declval<Coordinates_t>(),
+        std::declval<const StridedProResArr_t *>(),
+        std::declval<const StridedProResArr_t *>()))>> : std::true_type {};
+
+// Applies the stencil to element (t, u, v, k, j, i) of the region described by info
+template <int DIM, class Stencil, TopologicalElement FEL, TopologicalElement CEL>
+KOKKOS_FORCEINLINE_FUNCTION void
+DoStencil(const ProResInfo &info, const int t, const int u, const int v, const int k,
+          const int j, const int i, const IndexRange &ckb, const IndexRange &cjb,
+          const IndexRange &cib, const IndexRange &kb, const IndexRange &jb,
+          const IndexRange &ib) {
+  if constexpr (AcceptsStridedData<Stencil>::value) {
+    if (info.strided) {
+      Stencil::template Do<DIM, FEL, CEL>(t, u, v, k, j, i, ckb, cjb, cib, kb, jb, ib,
+                                          info.coords, info.coarse_coords,
+                                          &(info.coarse_strided), &(info.fine_strided));
+      return;
+    }
+  }
+  Stencil::template Do<DIM, FEL, CEL>(t, u, v, k, j, i, ckb, cjb, cib, kb, jb, ib,
+                                      info.coords, info.coarse_coords, &(info.coarse),
+                                      &(info.fine));
+}
+
+// Loops over the slice'th of nslices equal parts of the coarse elements CEL of buf
 template <int DIM, class Stencil, TopologicalElement FEL, TopologicalElement CEL>
 KOKKOS_INLINE_FUNCTION void InnerProlongationRestrictionLoop(
     team_mbr_t &team_member, std::size_t buf, const ProResInfoArr_t &info,
     const IndexRange &ckb, const IndexRange &cjb, const IndexRange &cib,
-    const IndexRange &kb, const IndexRange &jb, const IndexRange &ib) {
+    const IndexRange &kb, const IndexRange &jb, const IndexRange &ib, const int slice,
+    const int nslices) {
   const auto &idxer = info(buf).idxer[static_cast<int>(CEL)];
+  const int s = (idxer.size() * slice) / nslices;
+  const int e = (idxer.size() * (slice + 1)) / nslices - 1;
   par_for_inner(
-      inner_loop_pattern_tvr_tag, team_member, 0, idxer.size() - 1, [&](const int ii) {
+      inner_loop_pattern_tvr_tag, team_member, s, e, [&](const int ii) {
         const auto [t, u, v, k, j, i] = idxer(ii);
         if (idxer.IsActive(k, j, i)) {
-          Stencil::template Do<DIM, FEL, CEL>(t, u, v, k, j, i, ckb, cjb, cib, kb, jb, ib,
-                                              info(buf).coords, info(buf).coarse_coords,
-                                              &(info(buf).coarse), &(info(buf).fine));
+          DoStencil<DIM, Stencil, FEL, CEL>(info(buf), t, u, v, k, j, i, ckb, cjb, cib,
+                                            kb, jb, ib);
         }
       });
 }
@@ -108,11 +165,47 @@ KOKKOS_INLINE_FUNCTION void IterateInnerProlongationRestrictionLoop(Args &&...ar
       ...);
 }
 
+template <int DIM, class Stencil>
+KOKKOS_INLINE_FUNCTION void ProlongationRestrictionOnBuffer(
+    team_mbr_t &team_member, std::size_t buf, const ProResInfoArr_t &info,
+    const IndexRange &ckb, const IndexRange &cjb, const IndexRange &cib,
+    const IndexRange &kb, const IndexRange &jb, const IndexRange &ib, const int slice = 0,
+    const int nslices = 1) {
+  using TE = TopologicalElement;
+  if (info(buf).IncludeTopoEl(TE::CC))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::CC>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::F1))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::F1>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::F2))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::F2>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::F3))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::F3>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::E1))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::E1>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::E2))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::E2>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::E3))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::E3>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+  if (info(buf).IncludeTopoEl(TE::NN))
+    IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::NN>(
+        team_member, buf, info, ckb, cjb, cib, kb, jb, ib, slice, nslices);
+}
+
 template <int DIM, class Stencil>
 inline void
-ProlongationRestrictionLoop(const ProResInfoArr_t &info, const Idx_t &buffer_idxs,
-                            const IndexShape &cellbounds, const IndexShape &c_cellbounds,
-                            const RefinementOp_t op, const std::size_t nbuffers) {
+ProlongationRestrictionLoop(const DevExecSpace &exec_space, const ProResInfoArr_t &info,
+                            const Idx_t &buffer_idxs, const IndexShape &cellbounds,
+                            const IndexShape &c_cellbounds, const RefinementOp_t op,
+                            const std::size_t nbuffers, const int nslices = 1) {
+  PARTHENON_DEBUG_REQUIRE(nslices == 1 || ActsOnSameElementOnly<Stencil>(),
+                          "Buffers can only be split for independent elements");
   PARTHENON_INSTRUMENT
   const IndexDomain interior = IndexDomain::interior;
   auto ckb = c_cellbounds.GetBoundsK(interior);
@@ -124,58 +217,94 @@ ProlongationRestrictionLoop(const ProResInfoArr_t &info, const Idx_t &buffer_idx
   const int scratch_level = 1; // 0 is actual scratch (tiny); 1 is HBM
   size_t scratch_size_in_bytes = 1;
   par_for_outer(
-      DEFAULT_OUTER_LOOP_PATTERN, PARTHENON_AUTO_LABEL, DevExecSpace(),
-      scratch_size_in_bytes, scratch_level, 0, nbuffers - 1,
-      KOKKOS_LAMBDA(team_mbr_t team_member, const int sub_idx) {
-        const std::size_t buf = buffer_idxs(sub_idx);
-        if (DoRefinementOp(info(buf), op)) {
-          using TE = TopologicalElement;
-          if (info(buf).IncludeTopoEl(TE::CC))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::CC>(
-                team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::F1))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::F1>(
-                team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::F2))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::F2>(
-                team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::F3))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::F3>(
-                team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::E1))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::E1>(
-                team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::E2))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::E2>(
+      DEFAULT_OUTER_LOOP_PATTERN, PARTHENON_AUTO_LABEL, exec_space,
+      scratch_size_in_bytes, scratch_level, 0, nbuffers * nslices - 1,
+      KOKKOS_LAMBDA(team_mbr_t team_member, const int n) {
+        const std::size_t buf = buffer_idxs(n / nslices);
+        if (DoRefinementOp(info(buf), op))
+          ProlongationRestrictionOnBuffer<DIM, Stencil>(team_member, buf, info, ckb, cjb,
+                                                        cib, kb, jb, ib, n % nslices,
+                                                        nslices);
+      });
+}
+
+// Unpacks the boundary buffers of each group of regions (all regions of one variable on
+// one block) and then restricts, prolongates and internally prolongates those regions
+// in a single kernel. Within a group each step only reads data written by earlier steps
+// of the same group, so team barriers between the steps suffice. The buffers of all
+// groups of a subset must be received before this is called.
+template <int DIM, class RestrictionOp, class ProlongationOp,
+          class InternalProlongationOp>
+inline void
+FusedSetProlongationLoop(const DevExecSpace &exec_space, const BndInfoArr_t &bnd_info,
+                         const ProResInfoArr_t &info, const Idx_t &buffer_idxs,
+                         const Idx_t &group_starts, const IndexShape &cellbounds,
+                         const IndexShape &c_cellbounds, const std::size_t ngroups) {
+  PARTHENON_INSTRUMENT
+  const IndexDomain interior = IndexDomain::interior;
+  auto ckb = c_cellbounds.GetBoundsK(interior);
+  auto cjb = c_cellbounds.GetBoundsJ(interior);
+  auto cib = c_cellbounds.GetBoundsI(interior);
+  auto kb = cellbounds.GetBoundsK(interior);
+  auto jb = cellbounds.GetBoundsJ(interior);
+  auto ib = cellbounds.GetBoundsI(interior);
+  const int scratch_level = 1; // 0 is actual scratch (tiny); 1 is HBM
+  size_t scratch_size_in_bytes = 1;
+  par_for_outer(
+      DEFAULT_OUTER_LOOP_PATTERN, PARTHENON_AUTO_LABEL, exec_space,
+      scratch_size_in_bytes, scratch_level, 0, ngroups - 1,
+      KOKKOS_LAMBDA(team_mbr_t team_member, const int g) {
+        const std::size_t s = group_starts(g);
+        const std::size_t e = group_starts(g + 1);
+        for (std::size_t sub_idx = s; sub_idx < e; ++sub_idx) {
+          const auto &bnd = bnd_info(buffer_idxs(sub_idx));
+          if (bnd.same_to_same) continue;
+          int buf_offset = 0;
+          for (int it = 0; it < bnd.ntopological_elements; ++it) {
+            bnd.SetRows(team_member, it, 0, bnd.NumRows(it), buf_offset, true);
+            buf_offset += bnd.idxer[it].size();
+          }
+        }
+        team_member.team_barrier();
+        for (std::size_t sub_idx = s; sub_idx < e; ++sub_idx) {
+          const std::size_t buf = buffer_idxs(sub_idx);
+          if (DoRefinementOp(info(buf), RefinementOp_t::Restriction))
+            ProlongationRestrictionOnBuffer<DIM, RestrictionOp>(
                 team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::E3))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::E3>(
+        }
+        team_member.team_barrier();
+        for (std::size_t sub_idx = s; sub_idx < e; ++sub_idx) {
+          const std::size_t buf = buffer_idxs(sub_idx);
+          if (DoRefinementOp(info(buf), RefinementOp_t::Prolongation))
+            ProlongationRestrictionOnBuffer<DIM, ProlongationOp>(
                 team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
-          if (info(buf).IncludeTopoEl(TE::NN))
-            IterateInnerProlongationRestrictionLoop<DIM, Stencil, TE::NN>(
+        }
+        team_member.team_barrier();
+        for (std::size_t sub_idx = s; sub_idx < e; ++sub_idx) {
+          const std::size_t buf = buffer_idxs(sub_idx);
+          if (DoRefinementOp(info(buf), RefinementOp_t::Prolongation))
+            ProlongationRestrictionOnBuffer<DIM, InternalProlongationOp>(
                 team_member, buf, info, ckb, cjb, cib, kb, jb, ib);
         }
       });
 }
 
 template <int DIM, class Stencil, TopologicalElement FEL, TopologicalElement CEL>
-inline void
-InnerHostProlongationRestrictionLoop(std::size_t buf, const ProResInfoArrHost_t &info,
-                                     const IndexRange &ckb, const IndexRange &cjb,
-                                     const IndexRange &cib, const IndexRange &kb,
-                                     const IndexRange &jb, const IndexRange &ib) {
+inline void InnerHostProlongationRestrictionLoop(
+    const DevExecSpace &exec_space, std::size_t buf, const ProResInfoArrHost_t &info,
+    const IndexRange &ckb, const IndexRange &cjb, const IndexRange &cib,
+    const IndexRange &kb, const IndexRange &jb, const IndexRange &ib) {
   PARTHENON_INSTRUMENT
   const auto &idxer = info(buf).idxer[static_cast<int>(CEL)];
-  auto coords = info(buf).coords;
-  auto coarse_coords = info(buf).coarse_coords;
-  auto coarse = info(buf).coarse;
-  auto fine = info(buf).fine;
+  // The coordinates and arrays of the host info have to be captured by value
+  const ProResInfo pinfo = info(buf);
   par_for(
-      PARTHENON_AUTO_LABEL, 0, idxer.size() - 1, KOKKOS_LAMBDA(const int ii) {
+      DEFAULT_LOOP_PATTERN, PARTHENON_AUTO_LABEL, exec_space, 0, idxer.size() - 1,
+      KOKKOS_LAMBDA(const int ii) {
         const auto [t, u, v, k, j, i] = idxer(ii);
         if (idxer.IsActive(k, j, i)) {
-          Stencil::template Do<DIM, FEL, CEL>(t, u, v, k, j, i, ckb, cjb, cib, kb, jb, ib,
-                                              coords, coarse_coords, &coarse, &fine);
+          DoStencil<DIM, Stencil, FEL, CEL>(pinfo, t, u, v, k, j, i, ckb, cjb, cib, kb,
+                                            jb, ib);
         }
       });
 }
@@ -214,7 +343,8 @@ inline void IterateInnerHostProlongationRestrictionLoop(Args &&...args) {
 
 template <int DIM, class Stencil>
 inline void
-ProlongationRestrictionLoop(const ProResInfoArrHost_t &info_h,
+ProlongationRestrictionLoop(const DevExecSpace &exec_space,
+                            const ProResInfoArrHost_t &info_h,
                             const IdxHost_t &buffer_idxs_h, const IndexShape &cellbounds,
                             const IndexShape &c_cellbounds, const RefinementOp_t op,
                             const std::size_t nbuffers) {
@@ -233,45 +363,48 @@ ProlongationRestrictionLoop(const ProResInfoArrHost_t &info_h,
       using TE = TopologicalElement;
       if (info_h(buf).IncludeTopoEl(TE::CC))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::CC>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::F1))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::F1>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::F2))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::F2>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::F3))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::F3>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::E1))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::E1>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::E2))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::E2>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::E3))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::E3>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
       if (info_h(buf).IncludeTopoEl(TE::NN))
         IterateInnerHostProlongationRestrictionLoop<DIM, Stencil, TE::NN>(
-            buf, info_h, ckb, cjb, cib, kb, jb, ib);
+            exec_space, buf, info_h, ckb, cjb, cib, kb, jb, ib);
     }
   }
 }
 template <int DIM, class Stencil>
 inline void
-ProlongationRestrictionLoop(const ProResInfoArr_t &info,
+ProlongationRestrictionLoop(const DevExecSpace &exec_space, const ProResInfoArr_t &info,
                             const ProResInfoArrHost_t &info_h, const Idx_t &buffer_idxs,
                             const IdxHost_t &buffer_idxs_h, const IndexShape &cellbounds,
                             const IndexShape &c_cellbounds, const RefinementOp_t op,
                             const std::size_t nbuffers) {
-  if (nbuffers > Globals::refinement::min_num_bufs) {
-    ProlongationRestrictionLoop<DIM, Stencil>(info, buffer_idxs, cellbounds, c_cellbounds,
-                                              op, nbuffers);
-  } else {
-    ProlongationRestrictionLoop<DIM, Stencil>(info_h, buffer_idxs_h, cellbounds,
-                                              c_cellbounds, op, nbuffers);
+  // Rather than looping over buffers and elements on the host, split the buffers so
+  // that there are at least min_num_bufs teams in the single launch
+  int nslices = 1;
+  if constexpr (ActsOnSameElementOnly<Stencil>()) {
+    const int nbufs = static_cast<int>(nbuffers);
+    if (nbufs > 0 && nbufs < Globals::refinement::min_num_bufs)
+      nslices = (Globals::refinement::min_num_bufs + nbufs - 1) / nbufs;
   }
+  ProlongationRestrictionLoop<DIM, Stencil>(exec_space, info, buffer_idxs, cellbounds,
+                                            c_cellbounds, op, nbuffers, nslices);
 }
 
 template <class Stencil, class... Args>
@@ -285,6 +418,17 @@ inline void DoProlongationRestrictionOp(const IndexShape &cellbnds, Args &&...ar
   }
 }
 
+template <class... Ops, class... Args>
+inline void DoFusedSetProlongationOp(const IndexShape &cellbnds, Args &&...args) {
+  if (cellbnds.ncellsk(IndexDomain::entire) > 1) { // 3D
+    FusedSetProlongationLoop<3, Ops...>(std::forward<Args>(args)...);
+  } else if (cellbnds.ncellsj(IndexDomain::entire) > 1) { // 2D
+    FusedSetProlongationLoop<2, Ops...>(std::forward<Args>(args)...);
+  } else if (cellbnds.ncellsi(IndexDomain::entire) > 1) { // 1D
+    FusedSetProlongationLoop<1, Ops...>(std::forward<Args>(args)...);
+  }
+}
+
 } // namespace loops
 } // namespace refinement
 } // namespace parthenon
@@ -50,6 +50,11 @@
  *
  * However the same call pattern would NOT work with a templated function.
  *
+ * Ops whose Do is also templated on the type of the coarse and fine
+ * arrays, like the ones below, can be used for variables with
+ * Metadata::ComponentInnermost. They are passed strided views of those
+ * variables that are indexed like all other variables.
+ *
  * TODO(JMM): To enable custom prolongation/restriction operations, we
  * will need to provide (likely in state descriptor so it can be
  * per-variable) a templated function that registers the
@@ -109,14 +114,14 @@ struct RestrictAverage {
   }
 
   template <int DIM, TopologicalElement el = TopologicalElement::CC,
-            TopologicalElement /*cel*/ = TopologicalElement::CC>
+            TopologicalElement /*cel*/ = TopologicalElement::CC,
+            class Data = ParArrayND<Real, VariableState>>
   KOKKOS_FORCEINLINE_FUNCTION static void
   Do(const int l, const int m, const int n, const int ck, const int cj, const int ci,
      const IndexRange &ckb, const IndexRange &cjb, const IndexRange &cib,
      const IndexRange &kb, const IndexRange &jb, const IndexRange &ib,
      const Coordinates_t &coords, const Coordinates_t &coarse_coords,
-     const ParArrayND<Real, VariableState> *pcoarse,
-     const ParArrayND<Real, VariableState> *pfine) {
+     const Data *pcoarse, const Data *pfine) {
     constexpr bool INCLUDE_X1 =
         (DIM > 0) && (el == TE::CC || el == TE::F2 || el == TE::F3 || el == TE::E1);
     constexpr bool INCLUDE_X2 =
@@ -171,14 +176,14 @@ struct ProlongateSharedGeneral {
   }
 
   template <int DIM, TopologicalElement el = TopologicalElement::CC,
-            TopologicalElement /*cel*/ = TopologicalElement::CC>
+            TopologicalElement /*cel*/ = TopologicalElement::CC,
+            class Data = ParArrayND<Real, VariableState>>
   KOKKOS_FORCEINLINE_FUNCTION static void
   Do(const int l, const int m, const int n, const int k, const int j, const int i,
      const IndexRange &ckb, const IndexRange &cjb, const IndexRange &cib,
      const IndexRange &kb, const IndexRange &jb, const IndexRange &ib,
      const Coordinates_t &coords, const Coordinates_t &coarse_coords,
-     const ParArrayND<Real, VariableState> *pcoarse,
-     const ParArrayND<Real, VariableState> *pfine) {
+     const Data *pcoarse, const Data *pfine) {
     using namespace util;
     auto &coarse = *pcoarse;
     auto &fine = *pfine;
@@ -300,14 +305,14 @@ struct ProlongateInternalAverage {
   // values of the fine cells on the elements corresponding with the coarse cell
   // have been filled.
   template <int DIM, TopologicalElement fel = TopologicalElement::CC,
-            TopologicalElement cel = TopologicalElement::CC>
+            TopologicalElement cel = TopologicalElement::CC,
+            class Data = ParArrayND<Real, VariableState>>
   KOKKOS_FORCEINLINE_FUNCTION static void
   Do(const int l, const int m, const int n, const int k, const int j, const int i,
      const IndexRange &ckb, const IndexRange &cjb, const IndexRange &cib,
      const IndexRange &kb, const IndexRange &jb, const IndexRange &ib,
-     const Coordinates_t &coords, const Coordinates_t &coarse_coords,
-     const ParArrayND<Real, VariableState> *,
-     const ParArrayND<Real, VariableState> *pfine) {
+     const Coordinates_t &coords, const Coordinates_t &coarse_coords, const Data *,
+     const Data *pfine) {
     using namespace util;
 
     if constexpr (!IsSubmanifold(fel, cel)) {
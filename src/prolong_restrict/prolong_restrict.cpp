@@ -43,8 +43,8 @@ void Restrict(const StateDescriptor *resolved_packages, const ProResCache_t &cac
     loops::Idx_t subset = Kokkos::subview(cache.buffer_subsets, idx, Kokkos::ALL());
     loops::IdxHost_t subset_h =
         Kokkos::subview(cache.buffer_subsets_h, idx, Kokkos::ALL());
-    restrictor(cache.prores_info, cache.prores_info_h, subset, subset_h, cellbnds,
-               c_cellbnds, cache.buffer_subset_sizes[idx]);
+    restrictor(cache.exec_space, cache.prores_info, cache.prores_info_h, subset, subset_h,
+               cellbnds, c_cellbnds, cache.buffer_subset_sizes[idx]);
   }
 }
 
@@ -58,8 +58,8 @@ void ProlongateShared(const StateDescriptor *resolved_packages,
     loops::Idx_t subset = Kokkos::subview(cache.buffer_subsets, idx, Kokkos::ALL());
     loops::IdxHost_t subset_h =
         Kokkos::subview(cache.buffer_subsets_h, idx, Kokkos::ALL());
-    prolongator(cache.prores_info, cache.prores_info_h, subset, subset_h, cellbnds,
-                c_cellbnds, cache.buffer_subset_sizes[idx]);
+    prolongator(cache.exec_space, cache.prores_info, cache.prores_info_h, subset,
+                subset_h, cellbnds, c_cellbnds, cache.buffer_subset_sizes[idx]);
   }
 }
 
@@ -74,8 +74,27 @@ void ProlongateInternal(const StateDescriptor *resolved_packages,
     loops::Idx_t subset = Kokkos::subview(cache.buffer_subsets, idx, Kokkos::ALL());
     loops::IdxHost_t subset_h =
         Kokkos::subview(cache.buffer_subsets_h, idx, Kokkos::ALL());
-    internal_prolongator(cache.prores_info, cache.prores_info_h, subset, subset_h,
-                         cellbnds, c_cellbnds, cache.buffer_subset_sizes[idx]);
+    internal_prolongator(cache.exec_space, cache.prores_info, cache.prores_info_h, subset,
+                         subset_h, cellbnds, c_cellbnds, cache.buffer_subset_sizes[idx]);
+  }
+}
+
+void SetAndProlongate(const StateDescriptor *resolved_packages,
+                      const BndInfoArr_t &bnd_info, const ProResCache_t &cache,
+                      const IndexShape &cellbnds, const IndexShape &c_cellbnds) {
+  PARTHENON_DEBUG_REQUIRE(cache.all_regions_in_subsets,
+                          "Fused prolongation requires refinement ops for all regions");
+  const auto &ref_func_map = resolved_packages->RefinementFncsToIDs();
+  for (const auto &[func, idx] : ref_func_map) {
+    auto fused_set_prolongator = func.fused_set_prolongator;
+    PARTHENON_DEBUG_REQUIRE_THROWS(fused_set_prolongator != nullptr,
+                                   "Invalid prolongation op");
+    if (cache.group_subset_sizes[idx] == 0) continue;
+    loops::Idx_t subset = Kokkos::subview(cache.buffer_subsets, idx, Kokkos::ALL());
+    loops::Idx_t group_starts = Kokkos::subview(cache.group_starts, idx, Kokkos::ALL());
+    fused_set_prolongator(cache.exec_space, bnd_info, cache.prores_info, subset,
+                          group_starts, cellbnds, c_cellbnds,
+                          cache.group_subset_sizes[idx]);
   }
 }
 
@@ -55,6 +55,13 @@ void ProlongateInternal(const StateDescriptor *resolved_packages,
                         const ProResCache_t &cache, const IndexShape &cellbnds,
                         const IndexShape &c_cellbnds);
 
+// Unpacks the boundary buffers described by bnd_info and restricts and prolongates the
+// regions in cache in one kernel per set of refinement operations. Every region must
+// belong to a variable with refinement operations.
+void SetAndProlongate(const StateDescriptor *resolved_packages,
+                      const BndInfoArr_t &bnd_info, const ProResCache_t &cache,
+                      const IndexShape &cellbnds, const IndexShape &c_cellbnds);
+
 // std::function closures for the top-level restriction functions The
 // existence of host/device overloads here allows us to avoid a
 // deep-copy in the per-meshblock
@@ -64,17 +71,23 @@ void ProlongateInternal(const StateDescriptor *resolved_packages,
 // machinery, the info_h only overload will go away.
 
 using Restrictor_t = std::function<void(
-    const ProResInfoArr_t &, const ProResInfoArrHost_t &, const loops::Idx_t &,
-    const loops::IdxHost_t &, const IndexShape &, const IndexShape &, const std::size_t)>;
+    const DevExecSpace &, const ProResInfoArr_t &, const ProResInfoArrHost_t &,
+    const loops::Idx_t &, const loops::IdxHost_t &, const IndexShape &, const IndexShape &,
+    const std::size_t)>;
 using RestrictorHost_t =
     std::function<void(const ProResInfoArrHost_t &, const loops::IdxHost_t &,
                        const IndexShape &, const IndexShape &, const std::size_t)>;
 using Prolongator_t = std::function<void(
-    const ProResInfoArr_t &, const ProResInfoArrHost_t &, const loops::Idx_t &,
-    const loops::IdxHost_t &, const IndexShape &, const IndexShape &, const std::size_t)>;
+    const DevExecSpace &, const ProResInfoArr_t &, const ProResInfoArrHost_t &,
+    const loops::Idx_t &, const loops::IdxHost_t &, const IndexShape &, const IndexShape &,
+    const std::size_t)>;
 using ProlongatorHost_t =
     std::function<void(const ProResInfoArrHost_t &, const loops::IdxHost_t &,
                        const IndexShape &, const IndexShape &, const std::size_t)>;
+using FusedSetProlongator_t = std::function<void(
+    const DevExecSpace &, const BndInfoArr_t &, const ProResInfoArr_t &,
+    const loops::Idx_t &, const loops::Idx_t &, const IndexShape &, const IndexShape &,
+    const std::size_t)>;
 
 // Container struct owning refinement functions/closures.
 // this container needs to be uniquely hashable, and always the same
@@ -98,27 +111,30 @@ struct RefinementFunctions_t {
         std::string(typeid(InternalProlongationOp).name());
 
     RefinementFunctions_t funcs(label);
-    funcs.restrictor = [](const ProResInfoArr_t &info, const ProResInfoArrHost_t &info_h,
-                          const loops::Idx_t &idxs, const loops::IdxHost_t &idxs_h,
-                          const IndexShape &cellbnds, const IndexShape &c_cellbnds,
-                          const std::size_t nbuffers) {
+    funcs.component_innermost = loops::AcceptsStridedData<ProlongationOp>::value &&
+                                loops::AcceptsStridedData<RestrictionOp>::value &&
+                                loops::AcceptsStridedData<InternalProlongationOp>::value;
+    funcs.restrictor = [](const DevExecSpace &exec_space, const ProResInfoArr_t &info,
+                          const ProResInfoArrHost_t &info_h, const loops::Idx_t &idxs,
+                          const loops::IdxHost_t &idxs_h, const IndexShape &cellbnds,
+                          const IndexShape &c_cellbnds, const std::size_t nbuffers) {
       loops::DoProlongationRestrictionOp<RestrictionOp>(
-          cellbnds, info, info_h, idxs, idxs_h, cellbnds, c_cellbnds,
+          cellbnds, exec_space, info, info_h, idxs, idxs_h, cellbnds, c_cellbnds,
           RefinementOp_t::Restriction, nbuffers);
     };
     funcs.restrictor_host = [](const ProResInfoArrHost_t &info_h,
                                const loops::IdxHost_t &idxs_h, const IndexShape &cellbnds,
                                const IndexShape &c_cellbnds, const std::size_t nbuffers) {
       loops::DoProlongationRestrictionOp<RestrictionOp>(
-          cellbnds, info_h, idxs_h, cellbnds, c_cellbnds, RefinementOp_t::Restriction,
-          nbuffers);
+          cellbnds, DevExecSpace(), info_h, idxs_h, cellbnds, c_cellbnds,
+          RefinementOp_t::Restriction, nbuffers);
     };
-    funcs.prolongator = [](const ProResInfoArr_t &info, const ProResInfoArrHost_t &info_h,
-                           const loops::Idx_t &idxs, const loops::IdxHost_t &idxs_h,
-                           const IndexShape &cellbnds, const IndexShape &c_cellbnds,
-                           const std::size_t nbuffers) {
+    funcs.prolongator = [](const DevExecSpace &exec_space, const ProResInfoArr_t &info,
+                           const ProResInfoArrHost_t &info_h, const loops::Idx_t &idxs,
+                           const loops::IdxHost_t &idxs_h, const IndexShape &cellbnds,
+                           const IndexShape &c_cellbnds, const std::size_t nbuffers) {
       loops::DoProlongationRestrictionOp<ProlongationOp>(
-          cellbnds, info, info_h, idxs, idxs_h, cellbnds, c_cellbnds,
+          cellbnds, exec_space, info, info_h, idxs, idxs_h, cellbnds, c_cellbnds,
           RefinementOp_t::Prolongation, nbuffers);
     };
     funcs.prolongator_host = [](const ProResInfoArrHost_t &info_h,
@@ -126,16 +142,16 @@ struct RefinementFunctions_t {
                                 const IndexShape &cellbnds, const IndexShape &c_cellbnds,
                                 const std::size_t nbuffers) {
       loops::DoProlongationRestrictionOp<ProlongationOp>(
-          cellbnds, info_h, idxs_h, cellbnds, c_cellbnds, RefinementOp_t::Prolongation,
-          nbuffers);
+          cellbnds, DevExecSpace(), info_h, idxs_h, cellbnds, c_cellbnds,
+          RefinementOp_t::Prolongation, nbuffers);
     };
     funcs.internal_prolongator =
-        [](const ProResInfoArr_t &info, const ProResInfoArrHost_t &info_h,
-           const loops::Idx_t &idxs, const loops::IdxHost_t &idxs_h,
-           const IndexShape &cellbnds, const IndexShape &c_cellbnds,
-           const std::size_t nbuffers) {
+        [](const DevExecSpace &exec_space, const ProResInfoArr_t &info,
+           const ProResInfoArrHost_t &info_h, const loops::Idx_t &idxs,
+           const loops::IdxHost_t &idxs_h, const IndexShape &cellbnds,
+           const IndexShape &c_cellbnds, const std::size_t nbuffers) {
           loops::DoProlongationRestrictionOp<InternalProlongationOp>(
-              cellbnds, info, info_h, idxs, idxs_h, cellbnds, c_cellbnds,
+              cellbnds, exec_space, info, info_h, idxs, idxs_h, cellbnds, c_cellbnds,
               RefinementOp_t::Prolongation, nbuffers);
         };
     funcs.internal_prolongator_host =
@@ -143,9 +159,19 @@ struct RefinementFunctions_t {
            const IndexShape &cellbnds, const IndexShape &c_cellbnds,
            const std::size_t nbuffers) {
           loops::DoProlongationRestrictionOp<InternalProlongationOp>(
-              cellbnds, info_h, idxs_h, cellbnds, c_cellbnds,
+              cellbnds, DevExecSpace(), info_h, idxs_h, cellbnds, c_cellbnds,
               RefinementOp_t::Prolongation, nbuffers);
         };
+    funcs.fused_set_prolongator =
+        [](const DevExecSpace &exec_space, const BndInfoArr_t &bnd_info,
+           const ProResInfoArr_t &info, const loops::Idx_t &idxs,
+           const loops::Idx_t &group_starts, const IndexShape &cellbnds,
+           const IndexShape &c_cellbnds, const std::size_t ngroups) {
+          loops::DoFusedSetProlongationOp<RestrictionOp, ProlongationOp,
+                                          InternalProlongationOp>(
+              cellbnds, exec_space, bnd_info, info, idxs, group_starts, cellbnds,
+              c_cellbnds, ngroups);
+        };
     return funcs;
   }
   std::string label() const { return label_; }
@@ -159,6 +185,9 @@ struct RefinementFunctions_t {
   ProlongatorHost_t prolongator_host;
   Prolongator_t internal_prolongator;
   ProlongatorHost_t internal_prolongator_host;
+  FusedSetProlongator_t fused_set_prolongator;
+  // Whether all ops can be applied to variables with Metadata::ComponentInnermost
+  bool component_innermost = false;
 
  private:
   // TODO(JMM): This could be a type_info::hash instead of a string,
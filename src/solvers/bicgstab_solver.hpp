@@ -23,6 +23,7 @@
 #include "interface/state_descriptor.hpp"
 #include "kokkos_abstraction.hpp"
 #include "solvers/mg_solver.hpp"
+#include "solvers/solution_history.hpp"
 #include "solvers/solver_utils.hpp"
 
 #include "tasks/tasks.hpp"
@@ -38,6 +39,7 @@ struct BiCGSTABParams {
   bool precondition = true;
   bool print_per_step = false;
   bool relative_residual = false;
+  int num_previous_solutions = 0;
   BiCGSTABParams() = default;
   BiCGSTABParams(ParameterInput *pin, const std::string &input_block) {
     max_iters = pin->GetOrAddInteger(input_block, "max_iterations", max_iters);
@@ -48,6 +50,11 @@ struct BiCGSTABParams {
     mg_params = MGParams(pin, input_block);
     relative_residual =
         pin->GetOrAddBoolean(input_block, "relative_residual", relative_residual);
+    num_previous_solutions = pin->GetOrAddInteger(input_block, "num_previous_solutions",
+                                                  num_previous_solutions);
+    // The preconditioner is a linear operator that always starts from zero
+    mg_params.num_previous_solutions = 0;
+    mg_params.nonlinear = false;
   }
 };
 
@@ -77,13 +84,16 @@ class BiCGSTABSolver {
       auto pre_names = preconditioner.GetInternalVariableNames();
       names.insert(names.end(), pre_names.begin(), pre_names.end());
     }
+    auto history_names = history_.GetInternalVariableNames();
+    names.insert(names.end(), history_names.begin(), history_names.end());
     return names;
   }
 
   BiCGSTABSolver(StateDescriptor *pkg, BiCGSTABParams params_in,
                  equations eq_in = equations(), std::vector<int> shape = {})
       : preconditioner(pkg, params_in.mg_params, eq_in, shape), params_(params_in),
-        iter_counter(0), eqs_(eq_in) {
+        iter_counter(0), eqs_(eq_in),
+        history_(pkg, params_in.num_previous_solutions, shape) {
     using namespace refinement_ops;
     auto m_no_ghost =
         Metadata({Metadata::Cell, Metadata::Derived, Metadata::OneCopy}, shape);
@@ -119,13 +129,28 @@ class BiCGSTABSolver {
     auto copy_r = tl.AddTask(dependence, TF(CopyData<rhs, r>), md);
     auto copy_p = tl.AddTask(dependence, TF(CopyData<rhs, p>), md);
     auto copy_rhat0 = tl.AddTask(dependence, TF(CopyData<rhs, rhat0>), md);
-    auto get_rhat0r_init = DotProduct<rhat0, r>(dependence, tl, &rhat0r, md);
+    auto init_vectors = zero_x | zero_u_init | copy_r | copy_p | copy_rhat0;
+    if (history_.Enabled()) {
+      // Start from the extrapolated previous solutions instead: u <- guess, x <- u,
+      // r <- rhs - A u, rhat0 <- r, p <- r
+      auto guess = history_.template AddInitialGuessTasks<u>(tl, zero_u_init, md);
+      auto guess_comm =
+          AddBoundaryExchangeTasks<BoundaryType::any>(guess, tl, md_comm, multilevel);
+      auto get_Au = eqs_.template Ax<u, v>(tl, guess_comm, md);
+      auto set_x = tl.AddTask(guess | zero_x, TF(CopyData<u, x>), md);
+      auto set_r =
+          tl.AddTask(get_Au | copy_r, TF(AddFieldsAndStore<rhs, v, r>), md, 1.0, -1.0);
+      auto set_p = tl.AddTask(set_r | copy_p, TF(CopyData<r, p>), md);
+      auto set_rhat0 = tl.AddTask(set_r | copy_rhat0, TF(CopyData<r, rhat0>), md);
+      init_vectors = set_x | set_p | set_rhat0;
+    }
+    auto get_rhat0r_init = DotProduct<rhat0, r>(init_vectors, tl, &rhat0r, md);
     auto get_rhs2 = get_rhat0r_init;
     if (params_.relative_residual)
       get_rhs2 = DotProduct<rhs, rhs>(dependence, tl, &rhs2, md);
     auto initialize = tl.AddTask(
         TaskQualifier::once_per_region | TaskQualifier::local_sync,
-        zero_x | zero_u_init | copy_r | copy_p | copy_rhat0 | get_rhat0r_init | get_rhs2,
+        init_vectors | get_rhat0r_init | get_rhs2,
         "zero factors",
         [](BiCGSTABSolver *solver) {
           solver->iter_counter = -1;
@@ -301,7 +326,10 @@ class BiCGSTABSolver {
         this, pmesh, params_.max_iters, params_.residual_tolerance,
         params_.relative_residual);
 
-    return tl.AddTask(solver_id, TF(CopyData<x, u>), md);
+    auto copy_solution = tl.AddTask(solver_id, TF(CopyData<x, u>), md);
+    if (history_.Enabled())
+      return history_.template AddStoreTasks<u>(tl, copy_solution, md);
+    return copy_solution;
   }
 
   Real GetSquaredResidualSum() const { return residual.val; }
@@ -321,6 +349,7 @@ class BiCGSTABSolver {
   equations eqs_;
   Real final_residual;
   int final_iteration;
+  SolutionHistory<u> history_;
 };
 
 } // namespace solvers
@@ -24,8 +24,10 @@
 #include "interface/meshblock_data.hpp"
 #include "interface/state_descriptor.hpp"
 #include "kokkos_abstraction.hpp"
+#include "solvers/solution_history.hpp"
 #include "solvers/solver_utils.hpp"
 #include "tasks/tasks.hpp"
+#include "utils/concepts_lite.hpp"
 #include "utils/robust.hpp"
 
 namespace parthenon {
@@ -36,9 +38,13 @@ struct MGParams {
   int max_iters = 1000;
   Real residual_tolerance = 1.e-12;
   bool do_FAS = true;
+  bool nonlinear = false;
   std::string smoother = "SRJ2";
   bool two_by_two_diagonal = false;
   int max_coarsenings = std::numeric_limits<int>::max();
+  int num_previous_solutions = 0;
+  int line_direction = 1;
+  Real line_weight = 0.8;
 
   MGParams() = default;
   MGParams(ParameterInput *pin, const std::string &input_block) {
@@ -46,14 +52,39 @@ struct MGParams {
     residual_tolerance =
         pin->GetOrAddReal(input_block, "residual_tolerance", residual_tolerance);
     do_FAS = pin->GetOrAddBoolean(input_block, "do_FAS", do_FAS);
+    nonlinear = pin->GetOrAddBoolean(input_block, "nonlinear", nonlinear);
     smoother = pin->GetOrAddString(input_block, "smoother", smoother);
     two_by_two_diagonal =
         pin->GetOrAddBoolean(input_block, "two_by_two_diagonal", two_by_two_diagonal);
     max_coarsenings =
         pin->GetOrAddInteger(input_block, "max_coarsenings", max_coarsenings);
+    num_previous_solutions = pin->GetOrAddInteger(input_block, "num_previous_solutions",
+                                                  num_previous_solutions);
+    line_direction = pin->GetOrAddInteger(input_block, "line_direction", line_direction);
+    line_weight = pin->GetOrAddReal(input_block, "line_weight", line_weight);
   }
 };
 
+// Concept for equations classes that provide the couplings of each cell to its two
+// neighbors along a direction, which are required by line relaxation
+template <class lower_t, class upper_t>
+struct line_relaxation_equations {
+  template <class T>
+  auto requires_(T &&x)
+      -> void_t<decltype(x.template SetLineOffDiagonals<lower_t, upper_t>(
+          std::declval<std::shared_ptr<MeshData<Real>> &>(), 0))>;
+};
+
+// Concept for equations classes that can apply their operator to the interior and the
+// boundary cells of the blocks separately
+template <class x_t, class out_t>
+struct split_operator_equations {
+  template <class T>
+  auto requires_(T &&x) -> void_t<decltype(x.template Ax<x_t, out_t>(
+      std::declval<TaskList &>(), std::declval<TaskID>(),
+      std::declval<std::shared_ptr<MeshData<Real>> &>(), OperatorRegion::interior))>;
+};
+
 // The equations class must include a template method
 //
 //   template <class x_t, class y_t, class TL_t>
@@ -68,6 +99,22 @@ struct MGParams {
 //
 // That stores the (possibly approximate) diagonal of matrix A in the field
 // associated with the type diag_t. This is used for Jacobi iteration.
+//
+// If MGParams::nonlinear is set, Ax may be a nonlinear operator A(x) and SetDiagonal
+// must store the diagonal of its Jacobian at the current solution u. Multigrid then
+// is the full approximation scheme (FAS) with Jacobi-Newton smoothing, which requires
+// do_FAS and u to be flagged with Metadata::GMGRestrict.
+//
+// The line relaxation smoother (smoother = "line") additionally requires a method
+//
+//  template <class lower_t, class upper_t>
+//  TaskStatus SetLineOffDiagonals(std::shared_ptr<MeshData<Real>> &md, int dir)
+//
+// that stores the matrix elements coupling each cell to its lower and upper neighbor in
+// direction dir in the fields associated with lower_t and upper_t, respectively.
+//
+// If Ax takes an additional OperatorRegion argument, the smoother applies A to the
+// interior cells while the ghost cells are exchanged and to the boundary cells after.
 template <class u, class rhs, class equations>
 class MGSolver {
  public:
@@ -76,13 +123,33 @@ class MGSolver {
   PARTHENON_INTERNALSOLVERVARIABLE(u, temp); // Temporary storage
   PARTHENON_INTERNALSOLVERVARIABLE(u, u0);   // Storage for initial solution during FAS
   PARTHENON_INTERNALSOLVERVARIABLE(u, D);    // Storage for (approximate) diagonal
+  PARTHENON_INTERNALSOLVERVARIABLE(u, Dl);   // Lower off-diagonal along lines
+  PARTHENON_INTERNALSOLVERVARIABLE(u, Du);   // Upper off-diagonal along lines
+  PARTHENON_INTERNALSOLVERVARIABLE(u, Lc);   // Scratch for line solves
   std::vector<std::string> GetInternalVariableNames() const {
-    return {res_err::name(), temp::name(), u0::name(), D::name()};
+    std::vector<std::string> names{res_err::name(), temp::name(), u0::name(), D::name()};
+    if (params_.smoother == "line") {
+      names.insert(names.end(), {Dl::name(), Du::name(), Lc::name()});
+    }
+    auto history_names = history_.GetInternalVariableNames();
+    names.insert(names.end(), history_names.begin(), history_names.end());
+    return names;
   }
 
   MGSolver(StateDescriptor *pkg, MGParams params_in, equations eq_in = equations(),
            std::vector<int> shape = {})
-      : params_(params_in), iter_counter(0), eqs_(eq_in) {
+      : params_(params_in), iter_counter(0), eqs_(eq_in),
+        history_(pkg, params_in.num_previous_solutions, shape) {
+    PARTHENON_REQUIRE_THROWS(!params_.nonlinear || params_.do_FAS,
+                             "Nonlinear multigrid requires do_FAS = true.");
+    if (params_.smoother == "line") {
+      PARTHENON_REQUIRE_THROWS(HasLineOffDiagonals(),
+                               "Line relaxation requires SetLineOffDiagonals.");
+      PARTHENON_REQUIRE_THROWS(!params_.two_by_two_diagonal,
+                               "Line relaxation requires a scalar diagonal.");
+      PARTHENON_REQUIRE_THROWS(params_.line_direction >= 1 && params_.line_direction <= 3,
+                               "line_direction must be 1, 2 or 3.");
+    }
     using namespace parthenon::refinement_ops;
     // The ghost cells of res_err need to be filled, but this is accomplished by
     // copying res_err into u, communicating, then copying u back into res_err
@@ -107,12 +174,29 @@ class MGSolver {
     }
     auto mD = Metadata({Metadata::Cell, Metadata::Derived, Metadata::OneCopy}, Dshape);
     pkg->AddField(D::name(), mD);
+    if (params_.smoother == "line") {
+      auto mline =
+          Metadata({Metadata::Cell, Metadata::Derived, Metadata::OneCopy}, shape);
+      pkg->AddField(Dl::name(), mline);
+      pkg->AddField(Du::name(), mline);
+      pkg->AddField(Lc::name(), mline);
+    }
   }
 
   TaskID AddTasks(TaskList &tl, TaskID dependence, Mesh *pmesh, const int partition) {
     using namespace utils;
     TaskID none;
-    auto [itl, solve_id] = tl.AddSublist(dependence, {1, this->params_.max_iters});
+    auto partitions = pmesh->GetDefaultBlockPartitions(GridIdentifier::leaf());
+    if (partition >= partitions.size())
+      PARTHENON_FAIL("Does not work with non-default partitioning.");
+    auto &md = pmesh->mesh_data.Add("base", partitions[partition]);
+
+    // Otherwise, start from whatever is in u
+    auto guess = dependence;
+    if (history_.Enabled())
+      guess = history_.template AddInitialGuessTasks<u>(tl, dependence, md);
+
+    auto [itl, solve_id] = tl.AddSublist(guess, {1, this->params_.max_iters});
     iter_counter = -1;
     auto update_iter = itl.AddTask(
         TaskQualifier::local_sync | TaskQualifier::once_per_region, none, "print",
@@ -125,10 +209,6 @@ class MGSolver {
         &iter_counter);
     auto mg_finest = AddLinearOperatorTasks(itl, update_iter, partition, pmesh);
 
-    auto partitions = pmesh->GetDefaultBlockPartitions(GridIdentifier::leaf());
-    if (partition >= partitions.size())
-      PARTHENON_FAIL("Does not work with non-default partitioning.");
-    auto &md = pmesh->mesh_data.Add("base", partitions[partition]);
     auto comm = AddBoundaryExchangeTasks<BoundaryType::any>(mg_finest, itl, md,
                                                             pmesh->multilevel);
     auto calc_pointwise_res = eqs_.template Ax<u, res_err>(itl, comm, md);
@@ -150,6 +230,7 @@ class MGSolver {
         },
         this, pmesh);
 
+    if (history_.Enabled()) return history_.template AddStoreTasks<u>(tl, solve_id, md);
     return solve_id;
   }
 
@@ -207,9 +288,83 @@ class MGSolver {
   equations eqs_;
   Real final_residual;
   int final_iteration;
+  SolutionHistory<u> history_;
+
+  static constexpr bool HasLineOffDiagonals() {
+    return implements<line_relaxation_equations<Dl, Du>(equations)>::value;
+  }
+
+  static constexpr bool HasSplitOperator() {
+    return implements<split_operator_equations<u, temp>(equations)>::value;
+  }
+
   // These functions apparently have to be public to compile with cuda since
   // they contain device side lambdas
  public:
+  // Damped block Jacobi iteration in which the blocks are the lines of cells in direction
+  // params_.line_direction within each MeshBlock. The tridiagonal system of each line is
+  // solved with the Thomas algorithm, while couplings across lines and to the ghost cells
+  // are taken from xold.
+  template <class rhs_t, class Axold_t, class D_t, class xold_t, class xnew_t>
+  TaskStatus LineJacobi(std::shared_ptr<MeshData<Real>> &md, double weight) {
+    using namespace parthenon;
+    const int dir = params_.line_direction;
+    PARTHENON_REQUIRE(dir <= md->GetMeshPointer()->ndim,
+                      "line_direction exceeds the number of dimensions.");
+    using TE = parthenon::TopologicalElement;
+    TE te = TE::CC;
+    IndexRange ib = md->GetBoundsI(IndexDomain::interior, te);
+    IndexRange jb = md->GetBoundsJ(IndexDomain::interior, te);
+    IndexRange kb = md->GetBoundsK(IndexDomain::interior, te);
+    // Ranges along the lines (n) and across them (a, b)
+    const IndexRange nb = (dir == 1) ? ib : ((dir == 2) ? jb : kb);
+    const IndexRange ab = (dir == 3) ? jb : kb;
+    const IndexRange bb = (dir == 1) ? jb : ib;
+
+    int nblocks = md->NumBlocks();
+    std::vector<bool> include_block(nblocks, true);
+
+    static auto desc =
+        parthenon::MakePackDescriptor<xold_t, xnew_t, Axold_t, rhs_t, D_t, Dl, Du, Lc>(
+            md.get());
+    auto pack = desc.GetPack(md.get(), include_block);
+    parthenon::par_for(
+        "LineJacobi", 0, pack.GetNBlocks() - 1, ab.s, ab.e, bb.s, bb.e,
+        KOKKOS_LAMBDA(const int b, const int a, const int c) {
+          const int nvars =
+              pack.GetUpperBound(b, xnew_t()) - pack.GetLowerBound(b, xnew_t()) + 1;
+          for (int v = 0; v < nvars; ++v) {
+            // Cell n on the line, with k, j, i = (a, c, n), (a, n, c) or (n, a, c)
+            auto val = [&](auto var, const int n) -> Real & {
+              const int k = (dir == 3) ? n : a;
+              const int j = (dir == 2) ? n : ((dir == 3) ? a : c);
+              const int i = (dir == 1) ? n : c;
+              return pack(b, te, var, k, j, i);
+            };
+            // The right hand side only reads xnew (which may alias Axold) at n before
+            // it is overwritten by the solution
+            auto rhs_n = [&](const int n) {
+              Real r = val(rhs_t(v), n) - val(Axold_t(v), n) +
+                       val(D_t(v), n) * val(xold_t(v), n);
+              if (n > nb.s) r += val(Dl(v), n) * val(xold_t(v), n - 1);
+              if (n < nb.e) r += val(Du(v), n) * val(xold_t(v), n + 1);
+              return r;
+            };
+            utils::ThomasSolve(
+                nb.s, nb.e, [&](const int n) { return val(Dl(v), n); },
+                [&](const int n) { return val(D_t(v), n); },
+                [&](const int n) { return val(Du(v), n); }, rhs_n,
+                [&](const int n) -> Real & { return val(Lc(v), n); },
+                [&](const int n) -> Real & { return val(xnew_t(v), n); });
+            for (int n = nb.s; n <= nb.e; ++n) {
+              val(xnew_t(v), n) =
+                  weight * val(xnew_t(v), n) + (1.0 - weight) * val(xold_t(v), n);
+            }
+          }
+        });
+    return TaskStatus::complete;
+  }
+
   template <class rhs_t, class Axold_t, class D_t, class xold_t, class xnew_t>
   TaskStatus Jacobi(std::shared_ptr<MeshData<Real>> &md, double weight) {
     using namespace parthenon;
@@ -257,6 +412,8 @@ class MGSolver {
                 weight * v1 + (1.0 - weight) * pack(b, te, xold_t(1), k, j, i);
           });
     } else {
+      PARTHENON_REQUIRE(pack.ContiguousCellsHost(),
+                        "Jacobi does not support Metadata::ComponentInnermost");
       const int scratch_size = 0;
       const int scratch_level = 0;
       parthenon::par_for_outer(
@@ -295,11 +452,46 @@ class MGSolver {
 
     auto comm =
         AddBoundaryExchangeTasks<comm_boundary>(depends_on, tl, md_comm, multilevel);
-    auto mat_mult = eqs_.template Ax<in_t, out_t>(tl, comm, md);
+    TaskID mat_mult;
+    if constexpr (HasSplitOperator()) {
+      // Only the boundary cells have to wait for the ghost cells
+      auto interior = eqs_.template Ax<in_t, out_t>(tl, depends_on, md,
+                                                    OperatorRegion::interior);
+      mat_mult = eqs_.template Ax<in_t, out_t>(tl, comm | interior, md,
+                                               OperatorRegion::boundary);
+    } else {
+      mat_mult = eqs_.template Ax<in_t, out_t>(tl, comm, md);
+    }
+    // Linearize about the current iterate, which turns this into a Jacobi-Newton step
+    if (params_.nonlinear) {
+      mat_mult = mat_mult | AddSetMatrixElementsTasks(tl, comm, md);
+    }
+    if constexpr (HasLineOffDiagonals()) {
+      if (params_.smoother == "line")
+        return tl.AddTask(mat_mult,
+                          TF(&MGSolver::LineJacobi<rhs, out_t, D, in_t, out_t>), this,
+                          md, omega);
+    }
     return tl.AddTask(mat_mult, TF(&MGSolver::Jacobi<rhs, out_t, D, in_t, out_t>), this,
                       md, omega);
   }
 
+  // Sets the diagonal and, for line relaxation, the off-diagonals along the lines
+  template <class TL_t>
+  TaskID AddSetMatrixElementsTasks(TL_t &tl, TaskID depends_on,
+                                   std::shared_ptr<MeshData<Real>> &md) {
+    using namespace utils;
+    auto set_diag =
+        tl.AddTask(depends_on, TF(&equations::template SetDiagonal<D>), &eqs_, md);
+    if constexpr (HasLineOffDiagonals()) {
+      if (params_.smoother == "line")
+        return set_diag | tl.AddTask(depends_on,
+                                     TF(&equations::template SetLineOffDiagonals<Dl, Du>),
+                                     &eqs_, md, params_.line_direction);
+    }
+    return set_diag;
+  }
+
   template <parthenon::BoundaryType comm_boundary, class TL_t>
   TaskID AddSRJIteration(TL_t &tl, TaskID depends_on, int stages, bool multilevel,
                          std::shared_ptr<MeshData<Real>> &md,
@@ -319,6 +511,7 @@ class MGSolver {
     auto omega = omega_M1;
     if (stages == 2) omega = omega_M2;
     if (stages == 3) omega = omega_M3;
+    if (params_.smoother == "line") omega[ndim - 1][0] = params_.line_weight;
     // This copy is to set the coarse blocks in temp to the values in u so that
     // fine-coarse boundaries of temp are correctly updated during communication
     depends_on = tl.AddTask(depends_on, TF(CopyData<u, temp, false>), md);
@@ -382,6 +575,9 @@ class MGSolver {
     } else if (smoother == "SRJ3") {
       pre_stages = 3;
       post_stages = 3;
+    } else if (smoother == "line") {
+      pre_stages = 1;
+      post_stages = 1;
     } else {
       PARTHENON_FAIL("Unknown solver type.");
     }
@@ -403,6 +599,21 @@ class MGSolver {
     auto &md_comm = pmesh->mesh_data.AddShallow(
         "mg_comm", md, std::vector<std::string>{u::name(), res_err::name()});
 
+    // Receives from the coarser level are posted and polled from the start of the
+    // cycle rather than after the restricted residual has been sent, so that the
+    // prolongated error is received while this partition (and the other partitions on
+    // this rank) are still smoothing instead of only once nothing else is left to do.
+    // Only writing the received values into res_err has to wait for the residual.
+    auto recv_from_coarser = dependence;
+    if (level > min_level) {
+      auto start_recv_from_coarser = tl.AddTask(
+          dependence, TF(StartReceiveBoundBufs<BoundaryType::gmg_prolongate_recv>),
+          md_comm);
+      recv_from_coarser =
+          tl.AddTask(start_recv_from_coarser,
+                     TF(ReceiveBoundBufs<BoundaryType::gmg_prolongate_recv>), md_comm);
+    }
+
     // 0. Receive residual from coarser level if there is one
     auto set_from_finer = dependence;
     if (level < max_level) {
@@ -439,8 +650,7 @@ class MGSolver {
     }
 
     // 2. Do pre-smooth and fill solution on this level
-    set_from_finer =
-        tl.AddTask(set_from_finer, BTF(&equations::template SetDiagonal<D>), &eqs_, md);
+    set_from_finer = AddSetMatrixElementsTasks(tl, set_from_finer, md);
     auto pre_smooth = AddSRJIteration<BoundaryType::gmg_same>(
         tl, set_from_finer, pre_stages, multilevel, md, md_comm);
     // If we are finer than the coarsest level:
@@ -461,11 +671,9 @@ class MGSolver {
           residual, BTF(SendBoundBufs<BoundaryType::gmg_restrict_send>), md_comm);
 
       // 6. Receive error field into communication field and prolongate
-      auto recv_from_coarser =
-          tl.AddTask(communicate_to_coarse,
-                     TF(ReceiveBoundBufs<BoundaryType::gmg_prolongate_recv>), md_comm);
-      auto set_from_coarser = tl.AddTask(
-          recv_from_coarser, BTF(SetBounds<BoundaryType::gmg_prolongate_recv>), md_comm);
+      auto set_from_coarser =
+          tl.AddTask(communicate_to_coarse | recv_from_coarser,
+                     BTF(SetBounds<BoundaryType::gmg_prolongate_recv>), md_comm);
       auto prolongate =
           tl.AddTask(set_from_coarser,
                      BTF(ProlongateBounds<BoundaryType::gmg_prolongate_recv>), md_comm);
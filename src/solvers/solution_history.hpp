@@ -0,0 +1,134 @@
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+#ifndef SOLVERS_SOLUTION_HISTORY_HPP_
+#define SOLVERS_SOLUTION_HISTORY_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "interface/mesh_data.hpp"
+#include "interface/state_descriptor.hpp"
+#include "mesh/mesh.hpp"
+#include "solvers/solver_utils.hpp"
+#include "tasks/tasks.hpp"
+#include "utils/error_checking.hpp"
+
+namespace parthenon {
+
+namespace solvers {
+
+// Keeps the solutions of the last (up to three) solves of a sequence of related
+// systems, e.g. one per time step, and extrapolates them in the solve index to build
+// the initial guess of the next solve. The stored fields move with their blocks when the
+// mesh is load balanced, but the history is discarded whenever blocks have been refined
+// or derefined in between.
+template <class u>
+class SolutionHistory {
+ public:
+  PARTHENON_INTERNALSOLVERVARIABLE(u, prev0);
+  PARTHENON_INTERNALSOLVERVARIABLE(u, prev1);
+  PARTHENON_INTERNALSOLVERVARIABLE(u, prev2);
+  static constexpr int max_solutions = 3;
+
+  SolutionHistory() = default;
+  SolutionHistory(StateDescriptor *pkg, int nsolutions, std::vector<int> shape)
+      : nsolutions_(nsolutions) {
+    PARTHENON_REQUIRE_THROWS(nsolutions >= 0 && nsolutions <= max_solutions,
+                             "Between 0 and 3 previous solutions can be used.");
+    // The previous solutions cannot be rebuilt from independent fields, so they have to
+    // be sent along with blocks that are moved to another rank
+    auto m = Metadata({Metadata::Cell, Metadata::Derived, Metadata::OneCopy,
+                       Metadata::ForceRemeshComm},
+                      shape);
+    for (const auto &name : GetInternalVariableNames()) {
+      pkg->AddField(name, m);
+    }
+  }
+
+  bool Enabled() const { return nsolutions_ > 0; }
+
+  std::vector<std::string> GetInternalVariableNames() const {
+    std::vector<std::string> names{prev0::name(), prev1::name(), prev2::name()};
+    names.resize(nsolutions_);
+    return names;
+  }
+
+  // Number of previous solutions the next initial guess is built from
+  int NumAvailable(Mesh *pmesh) const {
+    return (MeshStamp(pmesh) == stamp_) ? std::min(nstored_, nsolutions_) : 0;
+  }
+
+  // Sets out to the extrapolation of the last n solutions, which is exact for solutions
+  // that are polynomials of degree n - 1 in the solve index. Leaves out unchanged if no
+  // solution is available.
+  template <class out>
+  TaskStatus Extrapolate(const std::shared_ptr<MeshData<Real>> &md, int n) const {
+    using namespace utils;
+    if (n == 1) return CopyData<prev0, out>(md);
+    if (n == 2) return AddFieldsAndStore<prev0, prev1, out>(md, 2.0, -1.0);
+    if (n == 3) {
+      AddFieldsAndStore<prev0, prev1, out>(md, 3.0, -3.0);
+      return AddFieldsAndStore<out, prev2, out>(md, 1.0, 1.0);
+    }
+    return TaskStatus::complete;
+  }
+
+  template <class out>
+  TaskID AddInitialGuessTasks(TaskList &tl, TaskID dependence,
+                              std::shared_ptr<MeshData<Real>> &md) {
+    return tl.AddTask(
+        dependence, "initial guess from previous solutions",
+        [](SolutionHistory *history, std::shared_ptr<MeshData<Real>> &md) {
+          const int n = history->NumAvailable(md->GetMeshPointer());
+          return history->template Extrapolate<out>(md, n);
+        },
+        this, md);
+  }
+
+  // Pushes the solution in onto the history
+  template <class in>
+  TaskID AddStoreTasks(TaskList &tl, TaskID dependence,
+                       std::shared_ptr<MeshData<Real>> &md) {
+    using namespace utils;
+    auto shift = dependence;
+    if (nsolutions_ > 2) shift = tl.AddTask(shift, TF(CopyData<prev1, prev2>), md);
+    if (nsolutions_ > 1) shift = tl.AddTask(shift, TF(CopyData<prev0, prev1>), md);
+    auto store = tl.AddTask(shift, TF(CopyData<in, prev0>), md);
+    return tl.AddTask(
+        TaskQualifier::once_per_region | TaskQualifier::local_sync, store,
+        "count stored solutions",
+        [](SolutionHistory *history, Mesh *pmesh) {
+          const int stamp = MeshStamp(pmesh);
+          history->nstored_ = (stamp == history->stamp_) ? history->nstored_ + 1 : 1;
+          history->stamp_ = stamp;
+          return TaskStatus::complete;
+        },
+        this, md->GetMeshPointer());
+  }
+
+ private:
+  // Changes whenever blocks are refined or derefined
+  static int MeshStamp(Mesh *pmesh) { return pmesh->nbnew + pmesh->nbdel; }
+
+  int nsolutions_ = 0;
+  int nstored_ = 0;
+  int stamp_ = -1;
+};
+
+} // namespace solvers
+
+} // namespace parthenon
+
+#endif // SOLVERS_SOLUTION_HISTORY_HPP_
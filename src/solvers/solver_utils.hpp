@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "kokkos_abstraction.hpp"
+#include "utils/robust.hpp"
 
 #define PARTHENON_INTERNALSOLVERVARIABLE(base, varname)                                  \
   struct varname : public parthenon::variable_names::base_t<false> {                     \
@@ -34,6 +35,12 @@ namespace parthenon {
 
 namespace solvers {
 
+// Cells of each block that an equations class applies its operator to. The boundary
+// cells touch a face of the block and the interior cells are all others. A x for the
+// interior cells does not depend on ghost cells, so it can be computed while the ghost
+// cells of x are still being exchanged.
+enum class OperatorRegion { all, interior, boundary };
+
 struct SparseMatrixAccessor {
   ParArray1D<int> ioff, joff, koff;
   const int nstencil;
@@ -148,6 +155,32 @@ struct Stencil {
 };
 
 namespace utils {
+// Solves the tridiagonal system lower(n) x(n - 1) + diag(n) x(n) + upper(n) x(n + 1) =
+// rhs(n) for n in [ns, ne] with the Thomas algorithm, ignoring lower(ns) and upper(ne).
+// The coefficients are functions of n, while x and the scratch c return references. The
+// right hand side at n is only evaluated before x(n) is written, so it may read x(n).
+template <class lower_t, class diag_t, class upper_t, class rhs_t, class c_t, class x_t>
+KOKKOS_INLINE_FUNCTION void ThomasSolve(const int ns, const int ne, const lower_t &lower,
+                                        const diag_t &diag, const upper_t &upper,
+                                        const rhs_t &rhs, const c_t &c, const x_t &x) {
+  // Forward elimination, with the modified upper diagonal in c and the modified right
+  // hand side in x
+  for (int n = ns; n <= ne; ++n) {
+    const Real r = rhs(n);
+    const Real l = (n > ns) ? lower(n) : 0.0;
+    const Real u = (n < ne) ? upper(n) : 0.0;
+    const Real cprev = (n > ns) ? c(n - 1) : 0.0;
+    const Real xprev = (n > ns) ? x(n - 1) : 0.0;
+    const Real denom = diag(n) - l * cprev;
+    c(n) = robust::ratio(u, denom);
+    x(n) = robust::ratio(r - l * xprev, denom);
+  }
+  // Back substitution
+  for (int n = ne - 1; n >= ns; --n) {
+    x(n) -= c(n) * x(n + 1);
+  }
+}
+
 template <class in_t, class out_t, bool only_fine_on_composite = true>
 TaskStatus CopyData(const std::shared_ptr<MeshData<Real>> &md) {
   using TE = parthenon::TopologicalElement;
@@ -158,6 +191,8 @@ TaskStatus CopyData(const std::shared_ptr<MeshData<Real>> &md) {
 
   static auto desc = parthenon::MakePackDescriptor<in_t, out_t>(md.get());
   auto pack = desc.GetPack(md.get(), only_fine_on_composite);
+  PARTHENON_REQUIRE(pack.ContiguousCellsHost(),
+                    "CopyData does not support Metadata::ComponentInnermost");
   const int scratch_size = 0;
   const int scratch_level = 0;
   // Warning: This inner loop strategy only works because we are using IndexDomain::entire
@@ -198,6 +233,8 @@ TaskStatus AddFieldsAndStoreInteriorSelect(const std::shared_ptr<MeshData<Real>>
 
   static auto desc = parthenon::MakePackDescriptor<a_t, b_t, out_t>(md.get());
   auto pack = desc.GetPack(md.get(), include_block, only_fine_on_composite);
+  PARTHENON_REQUIRE(pack.ContiguousCellsHost(),
+                    "AddFieldsAndStore does not support Metadata::ComponentInnermost");
   const int scratch_size = 0;
   const int scratch_level = 0;
   // Warning: This inner loop strategy only works because we are using IndexDomain::entire
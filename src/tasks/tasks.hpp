@@ -555,7 +555,11 @@ class TaskRegion {
     // declare this so it can call itself
     std::function<TaskStatus(Task *)> ProcessTask;
     ProcessTask = [&pool, &ProcessTask](Task *task) -> TaskStatus {
+      Kokkos::Timer timer;
       auto status = task->operator()();
+      if (status != TaskStatus::incomplete) {
+        Globals::task_busy_time_sec += timer.seconds();
+      }
       auto next_up = task->GetDependent(status);
       for (auto t : next_up) {
         if (t->ready()) {
@@ -573,6 +577,11 @@ class TaskRegion {
 
     // then wait until everything is done
     pool.wait();
+    // task lists may have launched kernels on different execution space instances, so
+    // make sure all of them have finished before the region is considered complete
+    Kokkos::Timer timer;
+    Kokkos::fence();
+    Globals::task_busy_time_sec += timer.seconds();
 
     // Check the results, so as to fire any exceptions from threads
     // Return failure if a task failed
@@ -18,6 +18,7 @@
 
 #include <numeric>
 #include <queue>
+#include <string>
 
 namespace parthenon {
 namespace AliasMethod {
@@ -75,5 +76,82 @@ AliasMethod::AliasMethod(const std::vector<Real> &probabilities)
   Kokkos::deep_copy(alias_table, host_alias_table);
 }
 
+AliasTables::AliasTables(const std::string &label, int ntables, int nentries)
+    : prob_table_(label + "_prob_table", ntables, nentries),
+      alias_table_(label + "_alias_table", ntables, nentries),
+      total_weight_(label + "_total_weight", ntables) {}
+
+void AliasTables::Build(DevExecSpace exec_space) {
+  auto prob = prob_table_;
+  auto alias = alias_table_;
+  auto total_weight = total_weight_;
+  const int n = NumEntries();
+  if (NumTables() == 0 || n == 0) return;
+
+  Kokkos::parallel_for(
+      "AliasTables::Build", team_policy(exec_space, NumTables(), Kokkos::AUTO),
+      KOKKOS_LAMBDA(team_mbr_t member) {
+        const int t = member.league_rank();
+        // An alias of -1 marks entries whose bucket has not been filled yet
+        Real sum = 0.0;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(member, n),
+            [&](const int m, Real &lsum) {
+              lsum += prob(t, m);
+              alias(t, m) = -1;
+            },
+            sum);
+        member.team_barrier();
+
+        Kokkos::single(Kokkos::PerTeam(member), [&]() {
+          total_weight(t) = sum;
+          if (sum <= 0.0) return;
+          const Real avg = sum / n;
+          // Light entries have less than the average weight, heavy entries at least the
+          // average. Both are swept once from left to right, the heavy entry j donates
+          // weight to light entries until it becomes light itself, at which point the
+          // next heavy entry fills up its bucket.
+          auto next_light = [&](int m) {
+            while (m < n && (alias(t, m) != -1 || prob(t, m) >= avg))
+              ++m;
+            return m;
+          };
+          auto next_heavy = [&](int m) {
+            while (m < n && (alias(t, m) != -1 || prob(t, m) < avg))
+              ++m;
+            return m;
+          };
+          int i = next_light(0);
+          int j = next_heavy(0);
+          Real w = j < n ? prob(t, j) : 0.0;
+          while (j < n) {
+            if (w > avg && i < n) {
+              const Real wi = prob(t, i);
+              prob(t, i) = wi / avg;
+              alias(t, i) = j;
+              w = (w + wi) - avg;
+              i = next_light(i + 1);
+            } else {
+              const int jn = next_heavy(j + 1);
+              if (jn >= n) break;
+              prob(t, j) = w / avg;
+              alias(t, j) = jn;
+              w = (w + prob(t, jn)) - avg;
+              j = jn;
+            }
+          }
+        });
+        member.team_barrier();
+
+        // Whatever is left over only differs from a full bucket by roundoff
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member, n), [&](const int m) {
+          if (alias(t, m) == -1) {
+            prob(t, m) = 1.0;
+            alias(t, m) = m;
+          }
+        });
+      });
+}
+
 } // namespace AliasMethod
 } // namespace parthenon
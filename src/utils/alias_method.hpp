@@ -16,6 +16,7 @@
 //  \brief Construct tables used to sample from a discrete probability distribution using
 //  the alias method
 
+#include <string>
 #include <vector>
 
 #include <kokkos_abstraction.hpp>
@@ -54,6 +55,59 @@ class AliasMethod {
   }
 };
 
+//! AliasTables
+//  \brief Set of alias tables that are built and sampled on the device
+//
+//  Holds ntables independent discrete distributions with nentries elements each, e.g.
+//  one table per block of a MeshData partition with one entry per cell. Weights are
+//  written to Weights() from a kernel, after which Build() turns them into alias tables
+//  in place using one team per table. The tables are constructed with the sweeping
+//  method of Huebschle-Schneider & Sanders (2022), which does not need work queues, so
+//  neither building nor sampling requires a round trip to the host.
+class AliasTables {
+ public:
+  AliasTables() = default;
+  AliasTables(const std::string &label, int ntables, int nentries);
+
+  // Unnormalized, non-negative weights of the entries of each table, indexed by
+  // (table, entry). Only valid until Build is called.
+  const ParArray2D<Real> &Weights() const { return prob_table_; }
+
+  // Build all tables from the current weights
+  void Build(DevExecSpace exec_space = DevExecSpace());
+
+  int NumTables() const { return prob_table_.extent_int(0); }
+  int NumEntries() const { return prob_table_.extent_int(1); }
+
+  // Sum of the weights of table t when it was built. Tables with zero total weight
+  // sample uniformly.
+  KOKKOS_INLINE_FUNCTION Real TotalWeight(const int t) const { return total_weight_(t); }
+
+  // Sample from table t given two independent random variables drawn from the uniform
+  // distribution [0,1). The returned value is the zero-based index of the sampled entry.
+  KOKKOS_INLINE_FUNCTION int Sample(const int t, const Real rand1,
+                                    const Real rand2) const {
+    const int n = prob_table_.extent_int(1);
+    int idx = static_cast<int>(rand1 * n);
+    idx = idx < n ? idx : n - 1;
+    return rand2 < prob_table_(t, idx) ? idx : alias_table_(t, idx);
+  }
+
+  // Sample from table t using a per-thread generator, e.g. obtained from a
+  // Kokkos::Random_XorShift64_Pool
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION int Sample(const int t, Generator &gen) const {
+    const Real rand1 = gen.drand();
+    const Real rand2 = gen.drand();
+    return Sample(t, rand1, rand2);
+  }
+
+ private:
+  ParArray2D<Real> prob_table_;
+  ParArray2D<int> alias_table_;
+  ParArray1D<Real> total_weight_;
+};
+
 } // namespace AliasMethod
 } // namespace parthenon
 
@@ -174,6 +174,29 @@ class SpatiallyMaskedIndexer : public Indexer<Ts...> {
     return active_(iidx, jidx, kidx);
   }
 
+  // True if IsActive is true everywhere in the index range, so that the mask does not
+  // have to be checked
+  bool AllActive() const {
+    constexpr int nt = sizeof...(Ts);
+    // Mask indices that occur along a direction of the index range
+    auto mask_range = [&](int d) -> std::pair<int, int> {
+      const int s = Indexer<Ts...>::start[d];
+      const int e = Indexer<Ts...>::end[d];
+      return (s == e) ? std::make_pair(0, 0) : std::make_pair(-1, 1);
+    };
+    const auto [is, ie] = mask_range(nt - 1);
+    const auto [js, je] = mask_range(nt - 2);
+    const auto [ks, ke] = mask_range(nt - 3);
+    for (int k = ks; k <= ke; ++k) {
+      for (int j = js; j <= je; ++j) {
+        for (int i = is; i <= ie; ++i) {
+          if (!active_(i, j, k)) return false;
+        }
+      }
+    }
+    return true;
+  }
+
  private:
   block_ownership_t active_;
 };
@@ -149,15 +149,7 @@ inline void ForEachBoundary(std::shared_ptr<MeshData<Real>> &md, F func) {
               if (nb.loc.level() - (bound == BoundaryType::flxcor_recv) !=
                   pmb->loc.level() - (bound == BoundaryType::flxcor_send))
                 continue;
-              bool correct = false;
-              if (nb.offsets.IsFace() && v->IsSet(Metadata::Face)) correct = true;
-              if ((nb.offsets.IsFace() || nb.offsets.IsEdge()) &&
-                  v->IsSet(Metadata::Edge))
-                correct = true;
-              if ((nb.offsets.IsFace() || nb.offsets.IsEdge() || nb.offsets.IsNode()) &&
-                  v->IsSet(Metadata::Node))
-                correct = true;
-              if (!correct) continue;
+              if (!NeedsFluxCorrection(nb, *v)) continue;
             }
             if (func_caller(func, pmb, rc, nb, v) == LoopControl::break_out) return;
           }
@@ -20,20 +20,29 @@
 
 #include <math.h>
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <memory>
-#include <stack>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
 
+#include "utils/error_checking.hpp"
+
 namespace parthenon {
 
 // Object for managing a pool of Kokkos::Views that
-// have the same instantiation call signature
+// have the same instantiation call signature. Getting objects from
+// and returning objects to the pool, as well as reference counting of
+// owner_t objects, is thread safe and lock free except for when the
+// pool has to grow.
 template <class T>
 class ObjectPool {
  public:
@@ -44,62 +53,185 @@ class ObjectPool {
 
  private:
   using KEY_T = uint64_t;
-  std::function<T(ObjectPool *)> get_resource_;
-  std::stack<weak_t> available_;
-  std::unordered_map<KEY_T, std::pair<weak_t, int>> inuse_;
   static const KEY_T default_key_ = KEY_T();
-  KEY_T keyc_;
+
+  // Every object of the pool lives in a slot that is neither moved nor freed before the
+  // pool is. The key of an object that is in use combines its slot index with the number
+  // of times the slot has been handed out, so that keys of returned objects stay invalid.
+  struct Slot {
+    weak_t obj;
+    std::atomic<KEY_T> key{default_key_};
+    std::atomic<int> count{0};
+    std::atomic<std::uint32_t> generation{0};
+    // One plus the index of the next slot in the free list, zero at its end
+    std::atomic<std::uint32_t> next{0};
+  };
+  static constexpr int slots_per_chunk_ = 256;
+  static constexpr int max_chunks_ = 4096;
+  // Number of returned objects a thread keeps for itself before it hands them back to
+  // the shared free list
+  static constexpr std::size_t thread_cache_size_ = 16;
+
+  struct State {
+    State() : id(NewPoolID()) {
+      for (auto &c : chunks)
+        c.store(nullptr, std::memory_order_relaxed);
+    }
+    const std::uint64_t id;
+    std::array<std::atomic<Slot *>, max_chunks_> chunks;
+    std::atomic<int> nslots{0};
+    std::atomic<std::uint64_t> object_size{0};
+    // The upper 32 bits are a tag that changes with every update of the list, to avoid
+    // ABA problems, the lower 32 bits are one plus the index of the first free slot
+    std::atomic<std::uint64_t> free_head{0};
+    // Guards growing the pool
+    std::mutex grow_mutex;
+    std::vector<std::unique_ptr<Slot[]>> chunk_storage;
+  };
+
+  std::function<T(ObjectPool *)> get_resource_;
+  // Held by pointer so the pool stays movable
+  std::unique_ptr<State> state_;
 
  public:
   template <class... Ts>
   explicit ObjectPool(std::function<T(ObjectPool *)> get_resource)
-      : get_resource_(get_resource), available_(), inuse_(), keyc_(default_key_) {}
+      : get_resource_(get_resource), state_(std::make_unique<State>()) {}
 
   weak_t Get();
 
   void PrintStatistics() const {
-    std::cout << available_.size() << " unused objects." << std::endl;
-    std::cout << inuse_.size() << " used objects." << std::endl;
+    const int nslots = state_->nslots.load(std::memory_order_acquire);
+    int nused = 0;
+    for (int idx = 0; idx < nslots; ++idx)
+      nused += (GetSlot(idx).key.load(std::memory_order_relaxed) != default_key_);
+    std::cout << nslots - nused << " unused objects." << std::endl;
+    std::cout << nused << " used objects." << std::endl;
   }
 
   std::uint64_t SizeInBytes() const {
     constexpr std::uint64_t datum_size = sizeof(typename base_t::value_type);
-    std::uint64_t object_size = 0;
-    if (inuse_.size() > 0)
-      object_size = inuse_.begin()->second.first.size();
-    else if (available_.size() > 0)
-      object_size = available_.top().size();
-    return datum_size * object_size * (inuse_.size() + available_.size());
+    return datum_size * state_->object_size.load(std::memory_order_relaxed) *
+           state_->nslots.load(std::memory_order_relaxed);
   }
 
   // This should be used with care since it can't generically be
   // checked that the input object has the same size as other objects
   // in the pool
-  void AddFreeObjectToPool(const T &in) { available_.push(in); }
-  void AddFreeObjectToPool(T &&in) { available_.emplace(in); }
+  void AddFreeObjectToPool(const T &in) { PushFree(NewSlot(in)); }
 
  private:
-  bool IsValid(const weak_t &in) const { return inuse_.count(in.key_); }
+  static std::uint64_t NewPoolID() {
+    static std::atomic<std::uint64_t> next_id{0};
+    return next_id++;
+  }
+
+  Slot &GetSlot(int idx) const {
+    Slot *chunk = state_->chunks[idx / slots_per_chunk_].load(std::memory_order_acquire);
+    return chunk[idx % slots_per_chunk_];
+  }
+  static int SlotIndex(KEY_T key) {
+    return static_cast<int>(key & 0xffffffffu) - 1;
+  }
+
+  // Store a new object of the pool in the next slot and return the index of the slot
+  int NewSlot(const T &in) {
+    std::lock_guard<std::mutex> lock(state_->grow_mutex);
+    const int idx = state_->nslots.load(std::memory_order_relaxed);
+    if (idx % slots_per_chunk_ == 0) {
+      const int chunk = idx / slots_per_chunk_;
+      PARTHENON_REQUIRE_THROWS(chunk < max_chunks_, "Object pool is full.");
+      state_->chunk_storage.push_back(std::make_unique<Slot[]>(slots_per_chunk_));
+      state_->chunks[chunk].store(state_->chunk_storage.back().get(),
+                                  std::memory_order_release);
+    }
+    GetSlot(idx).obj = weak_t(in);
+    state_->object_size.store(in.size(), std::memory_order_relaxed);
+    state_->nslots.store(idx + 1, std::memory_order_release);
+    return idx;
+  }
+
+  // Lock free stack of the free slots shared by all threads
+  void PushFree(int idx) {
+    auto &head = state_->free_head;
+    std::uint64_t old_head = head.load(std::memory_order_relaxed);
+    std::uint64_t new_head;
+    do {
+      GetSlot(idx).next.store(static_cast<std::uint32_t>(old_head),
+                              std::memory_order_relaxed);
+      new_head = (((old_head >> 32) + 1) << 32) | static_cast<std::uint64_t>(idx + 1);
+    } while (!head.compare_exchange_weak(old_head, new_head, std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  int PopFree() {
+    auto &head = state_->free_head;
+    std::uint64_t old_head = head.load(std::memory_order_acquire);
+    while (true) {
+      const std::uint32_t first = static_cast<std::uint32_t>(old_head);
+      if (first == 0) return -1;
+      // The slot may be popped by another thread in the meantime, in which case next is
+      // stale but the tag of the head has changed and the exchange fails
+      const std::uint32_t next = GetSlot(first - 1).next.load(std::memory_order_relaxed);
+      const std::uint64_t new_head = (((old_head >> 32) + 1) << 32) | next;
+      if (head.compare_exchange_weak(old_head, new_head, std::memory_order_acquire,
+                                     std::memory_order_acquire))
+        return first - 1;
+    }
+  }
+
+  // Objects returned by a thread are reused by the same thread without touching the
+  // shared free list, up to thread_cache_size_ of them. Objects cached by a thread that
+  // exits are not reused, which is fine for the long lived task threads.
+  std::vector<int> &ThreadCache() const {
+    static thread_local std::unordered_map<std::uint64_t, std::vector<int>> caches;
+    return caches[state_->id];
+  }
+
+  int Acquire() {
+    auto &cache = ThreadCache();
+    if (cache.size() > 0) {
+      const int idx = cache.back();
+      cache.pop_back();
+      return idx;
+    }
+    return PopFree();
+  }
+
+  void Release(const weak_t &in) {
+    Slot &slot = GetSlot(SlotIndex(in.key_));
+    // Only the thread that invalidates the key returns the slot
+    KEY_T expected = in.key_;
+    if (!slot.key.compare_exchange_strong(expected, default_key_,
+                                          std::memory_order_acq_rel))
+      return;
+    auto &cache = ThreadCache();
+    if (cache.size() < thread_cache_size_) {
+      cache.push_back(SlotIndex(in.key_));
+    } else {
+      PushFree(SlotIndex(in.key_));
+    }
+  }
+
+  bool IsValid(const weak_t &in) const {
+    if (in.key_ == default_key_) return false;
+    return GetSlot(SlotIndex(in.key_)).key.load(std::memory_order_acquire) == in.key_;
+  }
 
   void ReferenceCountedFree(const weak_t &in) {
     if (!IsValid(in)) return;
-    auto &pair = inuse_[in.key_];
-    --pair.second;
-    if (pair.second <= 0) {
-      available_.push(pair.first);
-      inuse_.erase(in.key_);
-    }
+    if (GetSlot(SlotIndex(in.key_)).count.fetch_sub(1, std::memory_order_acq_rel) <= 1)
+      Release(in);
   }
 
   void Free(const weak_t &in) {
     if (!IsValid(in)) return;
-    available_.push(inuse_[in.key_].first);
-    inuse_.erase(in.key_);
+    Release(in);
   }
 
   void AddCount(const weak_t &in) {
     if (!IsValid(in)) throw 1;
-    ++inuse_[in.key_].second;
+    GetSlot(SlotIndex(in.key_)).count.fetch_add(1, std::memory_order_relaxed);
   }
 };
 
@@ -227,23 +359,23 @@ class ObjectPool<T>::owner_t : public ObjectPool<T>::weak_t {
 
 template <class T>
 typename ObjectPool<T>::weak_t ObjectPool<T>::Get() {
-  weak_t out;
-  if (available_.size() > 0) {
-    out = available_.top();
-    available_.pop();
-  } else {
-    out = weak_t(get_resource_(this));
-  }
-  // Find an unused key that is not the default key
-  while (inuse_.count(++keyc_) != 0 || keyc_ == default_key_) {
-  }
+  int idx = Acquire();
+  // The resource getter may add free objects to the pool itself
+  if (idx < 0) idx = NewSlot(get_resource_(this));
+
+  Slot &slot = GetSlot(idx);
+  const std::uint32_t generation =
+      slot.generation.fetch_add(1, std::memory_order_relaxed) + 1;
+  const KEY_T key = (static_cast<KEY_T>(generation) << 32) | static_cast<KEY_T>(idx + 1);
   // Reference count should start from zero since copy constructor
   // or assignment operator of owner_t will increment the count
   // Warning: if a weak_t object is the only one that takes a piece
   //  of memory from the pool, that memory will never be returned to
   //  the pool unless it is explicitly freed.
-  inuse_[keyc_] = {out, 0};
-  out.key_ = keyc_;
+  slot.count.store(0, std::memory_order_relaxed);
+  slot.key.store(key, std::memory_order_release);
+  weak_t out = slot.obj;
+  out.key_ = key;
   out.pool_ = this;
   return out;
 }
@@ -25,6 +25,33 @@ sys.dont_write_bytecode = True
 
 class TestCase(utils.test_case.TestCaseAbs):
     def Prepare(self, parameters, step):
+        # Step 1: compare the exchanged block information to the gold standard
+        # Steps 2 and 3: check a variable with a reduced ghost depth on the same mesh,
+        # which includes fine-coarse boundaries. A depth of one is communicated as two
+        # ghost zones on multilevel meshes.
+        # Step 4: check the ghost zones across the faces between the trees of a cubed
+        # sphere shell, one of which is refined next to its neighbors
+        if step == 2 or step == 3:
+            depth = 4 - step
+            parameters.driver_cmd_line_args = [
+                "parthenon/job/problem_id=ghost_depth_%d" % depth,
+                "parthenon/mesh/nghost=4",
+                "parthenon/mesh/nx1=8",
+                "parthenon/mesh/nx2=8",
+                "parthenon/meshblock/nx1=8",
+                "parthenon/meshblock/nx2=8",
+                "boundary_exchange/ghost_depth=%d" % depth,
+            ]
+        if step == 4:
+            parameters.driver_cmd_line_args = [
+                "parthenon/job/problem_id=cubed_sphere",
+                "boundary_exchange/cubed_sphere=true",
+            ]
+            for d in [1, 2, 3]:
+                parameters.driver_cmd_line_args += [
+                    "parthenon/mesh/nx%d=4" % d,
+                    "parthenon/meshblock/nx%d=4" % d,
+                ]
 
         parameters.coverage_status = "both"
 
@@ -56,5 +83,20 @@ class TestCase(utils.test_case.TestCaseAbs):
             # don't check metadata, because SparseInfo will differ
             check_metadata=False,
         )
+        if delta != 0:
+            return False
+
+        checks = {"Ghost depth check": 0, "Cubed sphere check": 0}
+        for output in parameters.stdouts[1:]:
+            for line in output.decode("utf-8").split("\n"):
+                for check in checks:
+                    if line.startswith(check + ":"):
+                        checks[check] += 1
+                        if int(line.split()[3]) != 0:
+                            print("%s failed: %s" % (check, line))
+                            return False
+        if checks != {"Ghost depth check": 2, "Cubed sphere check": 1}:
+            print("Couldn't find the checks of all runs.")
+            return False
 
-        return delta == 0
+        return True
@@ -0,0 +1,5 @@
+# ========================================================================================
+# Parthenon performance portable AMR framework
+# Copyright(C) 2024 The Parthenon collaboration
+# Licensed under the 3-clause BSD License, see LICENSE file for details
+# ========================================================================================
@@ -0,0 +1,68 @@
+# ========================================================================================
+# Parthenon performance portable AMR framework
+# Copyright(C) 2024 The Parthenon collaboration
+# Licensed under the 3-clause BSD License, see LICENSE file for details
+# ========================================================================================
+
+# Modules
+import sys
+import utils.test_case
+
+""" To prevent littering up imported folders with .pyc files or __pycache_ folder"""
+sys.dont_write_bytecode = True
+
+
+class TestCase(utils.test_case.TestCaseAbs):
+    def Prepare(self, parameters, step):
+        # Step 1: one flux correction message per variable and boundary
+        if step == 1:
+            parameters.driver_cmd_line_args = [
+                "parthenon/mesh/combine_flux_corrections=false",
+                "parthenon/job/problem_id=separate",
+            ]
+        # Step 2: one flux correction message per boundary
+        if step == 2:
+            parameters.driver_cmd_line_args = [
+                "parthenon/mesh/combine_flux_corrections=true",
+                "parthenon/job/problem_id=combined",
+            ]
+        # Step 3: combined messages corrected through two subsets of the variables,
+        # which have to share the buffers laid out for all variables of a block
+        if step == 3:
+            parameters.driver_cmd_line_args = [
+                "parthenon/mesh/combine_flux_corrections=true",
+                "Advection/split_flux_correction=true",
+                "parthenon/job/problem_id=split",
+            ]
+
+        parameters.coverage_status = "both"
+        return parameters
+
+    def Analyse(self, parameters):
+        sys.path.insert(
+            1,
+            parameters.parthenon_path
+            + "/scripts/python/packages/parthenon_tools/parthenon_tools",
+        )
+
+        try:
+            from phdf_diff import compare
+        except ModuleNotFoundError:
+            print("Couldn't find module to compare Parthenon hdf5 files.")
+            return False
+
+        # Combining only changes how the corrections are sent, so results have to be
+        # bitwise identical
+        for problem_id in ["combined", "split"]:
+            delta = compare(
+                ["separate.out0.final.phdf", problem_id + ".out0.final.phdf"],
+                check_metadata=False,
+            )
+            if delta != 0:
+                print(
+                    "Results differ between separate and %s flux corrections."
+                    % problem_id
+                )
+                return False
+
+        return True
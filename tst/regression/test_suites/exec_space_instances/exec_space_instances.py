@@ -0,0 +1,79 @@
+# ========================================================================================
+# Parthenon performance portable AMR framework
+# Copyright(C) 2024 The Parthenon collaboration
+# Licensed under the 3-clause BSD License, see LICENSE file for details
+# ========================================================================================
+
+# Modules
+import sys
+import utils.test_case
+
+# Lowest throughput with several instances relative to a single one that is accepted.
+# Kernels of independent partitions overlap on device backends, which shows up as a
+# ratio above one. Host backends cannot overlap them, so the ratio is expected to be
+# close to one there and the margin only absorbs timing noise. A ratio well below one
+# means that partitions are serialized by fences.
+MIN_THROUGHPUT_RATIO = 0.75
+
+""" To prevent littering up imported folders with .pyc files or __pycache_ folder"""
+sys.dont_write_bytecode = True
+
+
+class TestCase(utils.test_case.TestCaseAbs):
+    def Prepare(self, parameters, step):
+        # Step 1: all partitions share the default execution space instance
+        if step == 1:
+            parameters.driver_cmd_line_args = [
+                "parthenon/mesh/num_exec_space_instances=1",
+                "parthenon/job/problem_id=single",
+            ]
+        # Step 2: partitions are distributed over several instances
+        if step == 2:
+            parameters.driver_cmd_line_args = [
+                "parthenon/mesh/num_exec_space_instances=3",
+                "parthenon/job/problem_id=multiple",
+            ]
+
+        parameters.coverage_status = "both"
+        return parameters
+
+    def Analyse(self, parameters):
+        sys.path.insert(
+            1,
+            parameters.parthenon_path
+            + "/scripts/python/packages/parthenon_tools/parthenon_tools",
+        )
+
+        try:
+            from phdf_diff import compare
+        except ModuleNotFoundError:
+            print("Couldn't find module to compare Parthenon hdf5 files.")
+            return False
+
+        # Instances only change the order of independent work, so results have to be
+        # bitwise identical
+        delta = compare(
+            ["single.out0.final.phdf", "multiple.out0.final.phdf"],
+            check_metadata=False,
+        )
+        if delta != 0:
+            print("Results differ between one and several execution space instances.")
+            return False
+
+        perfs = []
+        for output in parameters.stdouts:
+            for line in output.decode("utf-8").split("\n"):
+                if "zone-cycles/wallsecond" in line:
+                    perfs.append(float(line.split(" ")[2]))
+        if len(perfs) != 2:
+            print("Couldn't find the performance of both runs.")
+            return False
+        ratio = perfs[1] / perfs[0]
+        print(
+            "Throughput with several instances relative to a single one: %.3f" % ratio
+        )
+        if ratio < MIN_THROUGHPUT_RATIO:
+            print("Several execution space instances are slower than a single one.")
+            return False
+
+        return True
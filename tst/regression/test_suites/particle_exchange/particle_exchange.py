@@ -0,0 +1,64 @@
+# ========================================================================================
+# Parthenon performance portable AMR framework
+# Copyright(C) 2024 The Parthenon collaboration
+# Licensed under the 3-clause BSD License, see LICENSE file for details
+# ========================================================================================
+# (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+#
+# This program was produced under U.S. Government contract 89233218CNA000001 for Los
+# Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+# for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+# in the program are reserved by Triad National Security, LLC, and the U.S. Department
+# of Energy/National Nuclear Security Administration. The Government is granted for
+# itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+# license in this material to reproduce, prepare derivative works, distribute copies to
+# the public, perform publicly and display publicly, and to permit others to do so.
+# ========================================================================================
+
+# Modules
+import numpy as np
+
+import sys
+import utils.test_case
+
+# To prevent littering up imported folders with .pyc files or __pycache_ folder
+sys.dont_write_bytecode = True
+
+# Must match parthinput.particle_exchange
+NBLOCKS = 4
+NUM_PARTICLES = 10
+NCYCLES = 4
+DT = 0.5
+
+
+class TestCase(utils.test_case.TestCaseAbs):
+    def Prepare(self, parameters, step):
+
+        return parameters
+
+    def Analyse(self, parameters):
+        sys.path.insert(
+            1,
+            parameters.parthenon_path
+            + "/scripts/python/packages/parthenon_tools/parthenon_tools",
+        )
+        from phdf import phdf
+
+        data = phdf("particles.out0.final.phdf")
+        swarm = data.GetSwarm("my_particles")
+        # Boundaries are periodic and no particle is destroyed, so every particle that
+        # was created must have arrived on some block, whichever rounds it was sent in
+        expected = NBLOCKS * NUM_PARTICLES * NCYCLES
+        success = True
+        if len(swarm.x) != expected:
+            print("TEST FAIL: %d particles instead of %d" % (len(swarm.x), expected))
+            success = False
+        deposited = np.sum(data.Get("particle_deposition"))
+        if np.abs(deposited - expected) > 1e-10:
+            print("TEST FAIL: %g particles deposited" % deposited)
+            success = False
+        # The exchange only ends once all particles were pushed to the end of the step
+        if not np.all(np.abs(swarm["t"] - NCYCLES * DT) <= 1e-10):
+            print("TEST FAIL: Not all particles finished transport")
+            success = False
+        return success
@@ -23,9 +23,89 @@ import utils.test_case
 sys.dont_write_bytecode = True
 
 
+def GetResidualHistory(stdout):
+    """Returns the rms residuals printed after each multigrid v-cycle"""
+    residuals = []
+    for line in stdout.decode("utf-8").split("\n"):
+        words = line.split()
+        if len(words) == 2 and words[0].isdigit():
+            residuals.append(float(words[1]))
+    return residuals
+
+
 class TestCase(utils.test_case.TestCaseAbs):
     def Prepare(self, parameters, step):
+        # Step 1: linear Poisson equation with the input file as is
+        # Step 2: nonlinear operator, solved with FAS and Jacobi-Newton smoothing
+        # Step 3: anisotropic coefficient, solved with point Jacobi smoothing
+        # Step 4: anisotropic coefficient, solved with line relaxation along x1
+        # Step 5: linear Poisson equation with flux correction at fine-coarse boundaries
+        # The smoothers apply A to the interior and boundary cells of the blocks
+        # separately, while the residual is calculated with A applied to all cells at
+        # once. The solves only converge if both agree.
+        if step == 2:
+            parameters.driver_cmd_line_args = [
+                "parthenon/job/problem_id=nonlinear",
+                "poisson/nonlinear_beta=10.0",
+                "poisson/solver_params/nonlinear=true",
+                "poisson/solver_params/max_iterations=30",
+            ]
+        if step in [3, 4]:
+            parameters.driver_cmd_line_args = [
+                "poisson/anisotropy=8.0",
+                "poisson/solver_params/max_iterations=400",
+            ]
+            if step == 3:
+                parameters.driver_cmd_line_args += [
+                    "parthenon/job/problem_id=point",
+                    "poisson/solver_params/smoother=SRJ2",
+                ]
+            else:
+                parameters.driver_cmd_line_args += [
+                    "parthenon/job/problem_id=line",
+                    "poisson/solver_params/smoother=line",
+                    "poisson/solver_params/line_direction=1",
+                ]
+        if step == 5:
+            parameters.driver_cmd_line_args = [
+                "parthenon/job/problem_id=flux_correct",
+                "poisson/flux_correct=true",
+                "poisson/solver_params/max_iterations=30",
+            ]
         return parameters
 
     def Analyse(self, parameters):
+        tolerance = 1.0e-12
+        names = [
+            "linear",
+            "nonlinear",
+            "point Jacobi",
+            "line Jacobi",
+            "flux correction",
+        ]
+        iterations = {}
+        for name, stdout in zip(names, parameters.stdouts):
+            residuals = GetResidualHistory(stdout)
+            if len(residuals) < 2:
+                print("Couldn't find the residual history of the %s solve." % name)
+                return False
+            # Every v-cycle has to reduce the residual until it is converged
+            for prev, curr in zip(residuals[:-1], residuals[1:]):
+                if curr >= prev:
+                    print("The residual of the %s solve did not decrease." % name)
+                    return False
+            if residuals[-1] > tolerance:
+                print("The %s solve did not converge." % name)
+                return False
+            print("%s solve converged in %i v-cycles" % (name, len(residuals) - 1))
+            iterations[name] = len(residuals) - 1
+        if len(iterations) != len(names):
+            print("Not all solves were run.")
+            return False
+
+        # Line relaxation in the direction of strong coupling has to smooth the
+        # anisotropic problem much better than point Jacobi
+        if iterations["line Jacobi"] >= iterations["point Jacobi"]:
+            print("Line relaxation did not speed up the anisotropic solve.")
+            return False
         return True
@@ -52,11 +52,25 @@ class TestCase(utils.test_case.TestCaseAbs):
                 "parthenon/job/problem_id=silver9",
             ]
         # now restart from the walltime based output
-        else:
+        elif step == 4:
             parameters.driver_cmd_line_args = [
                 "-r",
                 "silver.out0.final.rhdf",
             ]
+        # run another baseline that only stores sparse variables on the blocks they are
+        # allocated on
+        elif step == 5:
+            parameters.driver_cmd_line_args = [
+                "parthenon/job/problem_id=bronze",
+                "parthenon/output0/compact_sparse=true",
+            ]
+        # and restart from one of its early snapshots
+        else:
+            parameters.driver_cmd_line_args = [
+                "-r",
+                "bronze.out0.00001.rhdf",
+                "parthenon/job/problem_id=copper",
+            ]
 
         return parameters
 
@@ -68,6 +82,7 @@ class TestCase(utils.test_case.TestCaseAbs):
         )
 
         try:
+            from phdf import phdf
             from phdf_diff import compare
         except ModuleNotFoundError:
             print("Couldn't find module to compare Parthenon hdf5 files.")
@@ -75,10 +90,10 @@ class TestCase(utils.test_case.TestCaseAbs):
 
         success = True
 
-        def compare_files(name, base="silver"):
+        def compare_files(name, base="silver", ref="gold"):
             delta = compare(
                 [
-                    "gold.out0.%s.rhdf" % name,
+                    "{}.out0.{}.rhdf".format(ref, name),
                     "{}.out0.{}.rhdf".format(base, name),
                 ],
                 one=True,
@@ -86,8 +101,8 @@ class TestCase(utils.test_case.TestCaseAbs):
 
             if delta != 0:
                 print(
-                    "ERROR: Found difference between gold and silver output '%s'."
-                    % name
+                    "ERROR: Found difference between %s and %s output '%s'."
+                    % (ref, base, name)
                 )
                 return False
 
@@ -100,6 +115,16 @@ class TestCase(utils.test_case.TestCaseAbs):
         success &= compare_files("final")
         success &= compare_files("final", "silver9")
 
+        # the restart file has to keep sparse variables that are not allocated on all
+        # blocks, or the compact layout is not exercised
+        bronze = phdf("bronze.out0.00005.rhdf")
+        sparse_info = bronze.fid["SparseInfo"]
+        if sparse_info.attrs.get("CompactSparse", 0) == 0 or sparse_info[:].all():
+            print("ERROR: No compactly stored sparse variables found in bronze output.")
+            success = False
+        for name in ["00005", "00009", "final"]:
+            success &= compare_files(name, "copper", "bronze")
+
         found_line = False
         for line in parameters.stdouts[1].decode("utf-8").split("\n"):
             if "Terminating on wall-time limit" in line:
@@ -0,0 +1,94 @@
+//========================================================================================
+// Parthenon performance portable AMR framework
+// Copyright(C) 2024 The Parthenon collaboration
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Kokkos_Core.hpp"
+#include "basic_types.hpp"
+#include "kokkos_abstraction.hpp"
+#include "utils/alias_method.hpp"
+
+using parthenon::Real;
+using parthenon::AliasMethod::AliasTables;
+
+TEST_CASE("Alias tables built on device", "[AliasTables]") {
+  GIVEN("Several tables of weights, including one with zero total weight") {
+    constexpr int ntables = 3;
+    constexpr int nentries = 7;
+    // weights(t, m)
+    auto weight = [](const int t, const int m) -> Real {
+      if (t == 0) return m + 1.0;
+      if (t == 1) return (m % 3 == 0) ? 0.0 : std::pow(2.0, m);
+      return 0.0;
+    };
+
+    AliasTables tables("test", ntables, nentries);
+    auto weights_h = Kokkos::create_mirror_view(tables.Weights());
+    for (int t = 0; t < ntables; ++t) {
+      for (int m = 0; m < nentries; ++m) {
+        weights_h(t, m) = weight(t, m);
+      }
+    }
+    Kokkos::deep_copy(tables.Weights(), weights_h);
+
+    WHEN("the tables are built and sampled on a regular grid of random numbers") {
+      tables.Build();
+
+      // Sampling at the center of every bucket with rand2 on a fine grid gives the
+      // probabilities encoded in the tables up to 1 / nrand per bucket
+      constexpr int nrand = 1000;
+      parthenon::ParArray2D<int> counts("counts", ntables, nentries);
+      parthenon::ParArray1D<Real> total("total", ntables);
+      Kokkos::parallel_for(
+          "unit::alias_tables::sample",
+          Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ntables, nentries, nrand}),
+          KOKKOS_LAMBDA(const int t, const int b, const int r) {
+            const Real rand1 = (b + 0.5) / nentries;
+            const Real rand2 = (r + 0.5) / nrand;
+            Kokkos::atomic_increment(&counts(t, tables.Sample(t, rand1, rand2)));
+            if (b == 0 && r == 0) total(t) = tables.TotalWeight(t);
+          });
+      auto counts_h = Kokkos::create_mirror_view(counts);
+      auto total_h = Kokkos::create_mirror_view(total);
+      Kokkos::deep_copy(counts_h, counts);
+      Kokkos::deep_copy(total_h, total);
+
+      THEN("the sampled frequencies match the normalized weights") {
+        for (int t = 0; t < ntables - 1; ++t) {
+          Real sum = 0.0;
+          for (int m = 0; m < nentries; ++m)
+            sum += weight(t, m);
+          REQUIRE(total_h(t) == Approx(sum));
+          for (int m = 0; m < nentries; ++m) {
+            const Real freq = static_cast<Real>(counts_h(t, m)) / (nentries * nrand);
+            REQUIRE(std::abs(freq - weight(t, m) / sum) <= 1.0 / nrand);
+          }
+        }
+      }
+
+      THEN("the table without weight samples uniformly") {
+        REQUIRE(total_h(ntables - 1) == 0.0);
+        for (int m = 0; m < nentries; ++m) {
+          REQUIRE(counts_h(ntables - 1, m) == nrand);
+        }
+      }
+    }
+  }
+}
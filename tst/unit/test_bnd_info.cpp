@@ -0,0 +1,225 @@
+//========================================================================================
+// Parthenon performance portable AMR framework
+// Copyright(C) 2024 The Parthenon collaboration
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "basic_types.hpp"
+#include "bvals/comms/bnd_info.hpp"
+#include "bvals/neighbor_block.hpp"
+#include "globals.hpp"
+#include "interface/metadata.hpp"
+#include "interface/variable.hpp"
+#include "mesh/forest/logical_location.hpp"
+#include "mesh/meshblock.hpp"
+
+// TODO(jcd): can't call the MeshBlock constructor without mesh_refinement.hpp???
+#include "mesh/mesh_refinement.hpp"
+
+using parthenon::block_ownership_t;
+using parthenon::BndChunk;
+using parthenon::CompactIndexRange;
+using parthenon::GetBndChunks;
+using parthenon::GetBufferSize;
+using parthenon::LogicalLocation;
+using parthenon::MeshBlock;
+using parthenon::Metadata;
+using parthenon::NeighborBlock;
+using parthenon::Real;
+using parthenon::RegionSize;
+using parthenon::SpatiallyMaskedIndexer6D;
+using parthenon::Variable;
+
+TEST_CASE("Compacting boundary index ranges", "[CompactIndexRange]") {
+  GIVEN("A range whose upper x1 plane is not owned by the sender") {
+    block_ownership_t owns(true);
+    for (int j : {-1, 0, 1})
+      for (int k : {-1, 0, 1})
+        owns(1, j, k) = false;
+    std::array<int, 3> s{0, 0, 0};
+    std::array<int, 3> e{2, 4, 0};
+    CompactIndexRange(&owns, &s, &e);
+    THEN("The plane is dropped and the remaining range is fully owned") {
+      REQUIRE(s == std::array<int, 3>{0, 0, 0});
+      REQUIRE(e == std::array<int, 3>{1, 4, 0});
+      for (int i : {-1, 0, 1})
+        for (int j : {-1, 0, 1})
+          REQUIRE(owns(i, j, 0));
+    }
+  }
+
+  GIVEN("A range whose upper x1 plane is only partially owned by the sender") {
+    block_ownership_t owns(true);
+    for (int j : {-1, 0})
+      for (int k : {-1, 0, 1})
+        owns(1, j, k) = false;
+    std::array<int, 3> s{0, 0, 0};
+    std::array<int, 3> e{2, 4, 0};
+    CompactIndexRange(&owns, &s, &e);
+    THEN("The range is unchanged and the unowned elements are still masked") {
+      REQUIRE(e == std::array<int, 3>{2, 4, 0});
+      REQUIRE(!owns(1, -1, 0));
+      REQUIRE(!owns(1, 0, 0));
+      REQUIRE(owns(1, 1, 0));
+    }
+  }
+}
+
+TEST_CASE("Boundary buffer sizes follow compacted ranges", "[GetBufferSize]") {
+  constexpr int N = 8;
+  constexpr int nghost = 2;
+  parthenon::Globals::nghost = nghost;
+
+  GIVEN("Two neighboring blocks on a uniform two dimensional grid") {
+    // Block a is the lower x1 neighbor of block b
+    auto pmb_a = std::make_shared<MeshBlock>(N, 2);
+    auto pmb_b = std::make_shared<MeshBlock>(N, 2);
+    const RegionSize block_size({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0},
+                                {N, N, 1});
+    pmb_a->gid = 0;
+    pmb_a->loc = LogicalLocation(1, 0, 0, 0);
+    pmb_a->block_size = block_size;
+    pmb_b->gid = 1;
+    pmb_b->loc = LogicalLocation(1, 1, 0, 0);
+    pmb_b->block_size = block_size;
+
+    // On a uniform grid every block owns its lower faces, edges, and nodes
+    block_ownership_t owns(false);
+    for (int i : {-1, 0})
+      for (int j : {-1, 0})
+        for (int k : {-1, 0, 1})
+          owns(i, j, k) = true;
+    owns.initialized = true;
+
+    auto make_nb = [&](std::shared_ptr<MeshBlock> &pmb, int ox1) {
+      NeighborBlock nb;
+      nb.rank = 0;
+      nb.gid = pmb->gid;
+      nb.loc = pmb->loc;
+      nb.origin_loc = pmb->loc;
+      nb.block_size = block_size;
+      nb.offsets = parthenon::CellCentOffsets(ox1, 0, 0);
+      nb.ownership = owns;
+      nb.origin_ownership = owns;
+      return nb;
+    };
+    const NeighborBlock nb_ab = make_nb(pmb_b, 1);
+    const NeighborBlock nb_ba = make_nb(pmb_a, -1);
+
+    WHEN("A node centered variable is communicated from a to b") {
+      Metadata m({Metadata::Node, Metadata::Independent, Metadata::FillGhost});
+      auto v_a = std::make_shared<Variable<Real>>("v", m, parthenon::InvalidSparseID,
+                                                  pmb_a);
+      auto v_b = std::make_shared<Variable<Real>>("v", m, parthenon::InvalidSparseID,
+                                                  pmb_b);
+      const int send_size = GetBufferSize(pmb_a.get(), nb_ab, v_a, true);
+      const int recv_size = GetBufferSize(pmb_b.get(), nb_ba, v_b, false);
+      THEN("Sender and receiver agree on the size of the buffer") {
+        REQUIRE(send_size == recv_size);
+      }
+      THEN("The buffer only holds the nodes owned by a") {
+        // The shared face is owned by b and the upper x2 edge by the block above a, so
+        // nghost planes of N nodes are sent instead of nghost + 1 planes of N + 1 nodes
+        REQUIRE(send_size == nghost * N);
+      }
+    }
+
+    WHEN("A cell centered variable is communicated from a to b") {
+      Metadata m({Metadata::Cell, Metadata::Independent, Metadata::FillGhost});
+      auto v_a = std::make_shared<Variable<Real>>("v", m, parthenon::InvalidSparseID,
+                                                  pmb_a);
+      auto v_b = std::make_shared<Variable<Real>>("v", m, parthenon::InvalidSparseID,
+                                                  pmb_b);
+      THEN("The buffer holds the ghost zones of b") {
+        REQUIRE(GetBufferSize(pmb_a.get(), nb_ab, v_a, true) == nghost * N);
+        REQUIRE(GetBufferSize(pmb_b.get(), nb_ba, v_b, false) == nghost * N);
+      }
+    }
+  }
+
+  // reset for subsequent unit tests
+  parthenon::Globals::nghost = 0;
+}
+
+TEST_CASE("Splitting boundaries into chunks", "[GetBndChunks]") {
+  GIVEN("The x1 face, x2 face, and two corners of a two dimensional block") {
+    constexpr int N = 16;
+    const block_ownership_t owns(true);
+    auto idxer = [&](int je, int ie) {
+      return SpatiallyMaskedIndexer6D(owns, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, je},
+                                      {0, ie});
+    };
+    parthenon::BndInfoArr_t bnd_info("bnd_info", 3);
+    auto bnd_info_h = Kokkos::create_mirror_view(bnd_info);
+    // N short rows
+    bnd_info_h(0).idxer[0] = idxer(N - 1, 1);
+    // Two long rows
+    bnd_info_h(1).idxer[0] = idxer(1, N - 1);
+    // Two topological elements with two short rows each
+    bnd_info_h(2).ntopological_elements = 2;
+    bnd_info_h(2).idxer[0] = idxer(1, 1);
+    bnd_info_h(2).idxer[1] = idxer(1, 1);
+
+    WHEN("The boundaries are split into chunks") {
+      const auto chunks = GetBndChunks(bnd_info_h);
+      // 72 elements on 3 boundaries
+      constexpr int size_per_chunk = 24;
+
+      THEN("Every row of every element is in exactly one chunk at the right offset") {
+        for (int b = 0; b < 3; ++b) {
+          int buf_offset = 0;
+          for (int it = 0; it < bnd_info_h(b).ntopological_elements; ++it) {
+            int row = 0;
+            for (const auto &chunk : chunks) {
+              if (chunk.b != b || chunk.it != it) continue;
+              REQUIRE(chunk.row_s == row);
+              REQUIRE(chunk.buf_offset == buf_offset);
+              row = chunk.row_e;
+            }
+            REQUIRE(row == bnd_info_h(b).NumRows(it));
+            buf_offset += bnd_info_h(b).idxer[it].size();
+          }
+        }
+      }
+
+      THEN("No chunk holds more than the element budget or a single row") {
+        for (const auto &chunk : chunks) {
+          const auto &bi = bnd_info_h(chunk.b);
+          const int row_size = bi.idxer[chunk.it].size() / bi.NumRows(chunk.it);
+          REQUIRE((chunk.row_e - chunk.row_s) * row_size <=
+                  std::max(size_per_chunk, row_size));
+        }
+      }
+
+      THEN("Boundaries are split by their number of elements, not rows") {
+        auto nchunks = [&](int b) {
+          return std::count_if(chunks.begin(), chunks.end(),
+                               [b](const BndChunk &c) { return c.b == b; });
+        };
+        // 32 elements in 16 rows of 2 and 2 rows of 16 respectively
+        REQUIRE(nchunks(0) == 2);
+        REQUIRE(nchunks(1) == 2);
+        // One chunk per topological element
+        REQUIRE(nchunks(2) == 2);
+      }
+    }
+  }
+}
@@ -15,7 +15,10 @@
 // the public, perform publicly and display publicly, and to permit others to do so.
 //========================================================================================
 
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include <catch2/catch.hpp>
@@ -181,3 +184,173 @@ TEST_CASE("Singular forest construction", "[forest]") {
     REQUIRE(locs.size() == 93);
   }
 }
+
+TEST_CASE("Three dimensional forest construction", "[forest]") {
+  GIVEN("Two cubic trees connected through a face with rotated coordinates") {
+    using parthenon::BoundaryFlag;
+    using parthenon::LogicalLocation;
+    std::array<std::shared_ptr<Node>, 12> n;
+    auto idx = [](int ix, int iy, int iz) { return ix + 3 * (iy + 2 * iz); };
+    for (int iz = 0; iz < 2; ++iz) {
+      for (int iy = 0; iy < 2; ++iy) {
+        for (int ix = 0; ix < 3; ++ix)
+          n[idx(ix, iy, iz)] =
+              Node::create(idx(ix, iy, iz), {1.0 * ix, 1.0 * iy, 1.0 * iz});
+      }
+    }
+    ForestDefinition forest_def;
+    forest_def.AddCell(0, {n[idx(0, 0, 0)], n[idx(1, 0, 0)], n[idx(0, 1, 0)],
+                           n[idx(1, 1, 0)], n[idx(0, 0, 1)], n[idx(1, 0, 1)],
+                           n[idx(0, 1, 1)], n[idx(1, 1, 1)]});
+    // The x2 direction of the second tree is the global x3 direction and its x3
+    // direction is the negative global x2 direction
+    std::array<std::shared_ptr<Node>, 8> nodes1;
+    for (int b = 0; b < 8; ++b)
+      nodes1[b] = n[idx(1 + (b & 1), 1 - ((b >> 2) & 1), (b >> 1) & 1)];
+    forest_def.AddCell(1, nodes1);
+
+    for (int ix : {0, 1}) {
+      for (int side : {0, 1}) {
+        forest_def.AddBC({n[idx(ix, side, 0)], n[idx(ix + 1, side, 0)],
+                          n[idx(ix, side, 1)], n[idx(ix + 1, side, 1)]},
+                         BoundaryFlag::outflow);
+        forest_def.AddBC({n[idx(ix, 0, side)], n[idx(ix + 1, 0, side)],
+                          n[idx(ix, 1, side)], n[idx(ix + 1, 1, side)]},
+                         BoundaryFlag::outflow);
+      }
+    }
+    for (int ix : {0, 2})
+      forest_def.AddBC({n[idx(ix, 0, 0)], n[idx(ix, 1, 0)], n[idx(ix, 0, 1)],
+                        n[idx(ix, 1, 1)]},
+                       BoundaryFlag::outflow);
+    forest_def.SetBlockSize(parthenon::RegionSize({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0},
+                                                  {1.0, 1.0, 1.0}, {8, 8, 8}));
+
+    auto forest = Forest::Make3D(forest_def);
+    REQUIRE(forest.GetMeshBlockListAndResolveGids().size() == 2);
+
+    THEN("Refinement next to the shared face propagates into the other tree") {
+      forest.Refine(LogicalLocation(0, 0, 0, 0, 0));
+      forest.Refine(LogicalLocation(0, 1, 1, 0, 0));
+      REQUIRE(forest.GetMeshBlockListAndResolveGids().size() == 23);
+    }
+
+    THEN("Refinement away from the shared face does not") {
+      forest.Refine(LogicalLocation(0, 0, 0, 0, 0));
+      forest.Refine(LogicalLocation(0, 1, 0, 0, 0));
+      REQUIRE(forest.GetMeshBlockListAndResolveGids().size() == 16);
+    }
+
+    THEN("The neighbor across the shared face is found in the other tree") {
+      forest.GetMeshBlockListAndResolveGids();
+      auto neighbors = forest.FindNeighbors(LogicalLocation(0, 0, 0, 0, 0), 1, 0, 0);
+      REQUIRE(neighbors.size() == 1);
+      REQUIRE(neighbors[0].global_loc.tree() == 1);
+      REQUIRE(forest.FindNeighbors(LogicalLocation(0, 0, 0, 0, 0), -1, 0, 0).empty());
+    }
+  }
+
+  GIVEN("A cubed sphere shell made of six trees") {
+    using parthenon::BoundaryFlag;
+    using parthenon::LogicalLocation;
+    // Nodes 0 to 7 are the corners of the inner cube and nodes 8 to 15 those of the
+    // outer cube, where bit d of the node index is set on the upper side of direction d
+    std::array<std::shared_ptr<Node>, 16> n;
+    for (int c = 0; c < 16; ++c) {
+      const parthenon::Real r = (c < 8) ? 1.0 : 2.0;
+      n[c] = Node::create(c, {(c & 1) ? r : -r, (c & 2) ? r : -r, (c & 4) ? r : -r});
+    }
+    // Every tree lies between a face of the inner cube and the face of the outer cube
+    // above it. Its x3 direction points outward and its x1 and x2 directions are the
+    // other two global directions in cyclic order, so neighboring trees are rotated
+    // and reflected with respect to each other.
+    ForestDefinition forest_def;
+    for (int dir = 0; dir < 3; ++dir) {
+      for (int side = 0; side < 2; ++side) {
+        std::array<std::shared_ptr<Node>, 8> nodes;
+        for (int b = 0; b < 8; ++b) {
+          const int corner = (side << dir) | ((b & 1) << ((dir + 1) % 3)) |
+                             (((b >> 1) & 1) << ((dir + 2) % 3));
+          nodes[b] = n[corner + ((b & 4) ? 8 : 0)];
+        }
+        forest_def.AddCell(2 * dir + side, nodes);
+        forest_def.AddBC({nodes[0], nodes[1], nodes[2], nodes[3]}, BoundaryFlag::outflow);
+        forest_def.AddBC({nodes[4], nodes[5], nodes[6], nodes[7]}, BoundaryFlag::outflow);
+      }
+    }
+    forest_def.SetBlockSize(parthenon::RegionSize({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0},
+                                                  {1.0, 1.0, 1.0}, {8, 8, 8}));
+
+    auto forest = Forest::Make3D(forest_def);
+    REQUIRE(forest.GetMeshBlockListAndResolveGids().size() == 6);
+
+    THEN("Trees only have neighbors across the faces between inner and outer cube") {
+      for (int t = 0; t < 6; ++t) {
+        const LogicalLocation loc(t, 0, 0, 0, 0);
+        for (int ox1 : {-1, 1}) {
+          auto nx1 = forest.FindNeighbors(loc, ox1, 0, 0);
+          auto nx2 = forest.FindNeighbors(loc, 0, ox1, 0);
+          REQUIRE(nx1.size() == 1);
+          REQUIRE(nx2.size() == 1);
+          REQUIRE(nx1[0].global_loc.tree() != t);
+          REQUIRE(nx2[0].global_loc.tree() != t);
+          REQUIRE(nx1[0].global_loc.tree() != nx2[0].global_loc.tree());
+          REQUIRE(forest.FindNeighbors(loc, 0, 0, ox1).empty());
+          // Three trees meet at every edge between the inner and the outer cube, so
+          // there is no tree diagonally across it
+          for (int ox2 : {-1, 1})
+            REQUIRE(forest.FindNeighbors(loc, ox1, ox2, 0).empty());
+        }
+      }
+    }
+
+    WHEN("Every tree is refined once") {
+      for (int t = 0; t < 6; ++t)
+        forest.Refine(LogicalLocation(t, 0, 0, 0, 0));
+      const auto locs = forest.GetMeshBlockListAndResolveGids();
+      REQUIRE(locs.size() == 48);
+
+      THEN("Edge and node neighbors are found across tree faces but not tree edges") {
+        // Each block touches an edge where three trees meet, so one of the 16 blocks
+        // around it in a Cartesian grid is missing
+        for (const auto &loc : locs)
+          REQUIRE(forest.FindNeighbors(loc).size() == 15);
+
+        const LogicalLocation loc(0, 1, 0, 0, 1);
+        // Edge and node neighbors that only leave the tree across a face
+        auto edge = forest.FindNeighbors(loc, -1, 0, -1);
+        auto node = forest.FindNeighbors(loc, -1, 1, -1);
+        REQUIRE(edge.size() == 1);
+        REQUIRE(node.size() == 1);
+        REQUIRE(edge[0].global_loc.tree() != 0);
+        REQUIRE(node[0].global_loc.tree() == edge[0].global_loc.tree());
+        REQUIRE(loc.GetSameLevelOffsets(edge[0].origin_loc) ==
+                std::array<int, 3>{-1, 0, -1});
+        REQUIRE(loc.GetSameLevelOffsets(node[0].origin_loc) ==
+                std::array<int, 3>{-1, 1, -1});
+        // Edge and node neighbors diagonally across the edge where three trees meet
+        REQUIRE(forest.FindNeighbors(loc, -1, -1, 0).empty());
+        REQUIRE(forest.FindNeighbors(loc, -1, -1, -1).empty());
+      }
+
+      THEN("Neighbor relations are symmetric and coordinate transforms round trip") {
+        const std::array<std::array<int, 3>, 3> cells{{{0, 0, 0}, {1, 2, 3}, {7, 0, 5}}};
+        for (const auto &loc : locs) {
+          for (const auto &nl : forest.FindNeighbors(loc)) {
+            auto ct = nl.lcoord_trans;
+            REQUIRE(ct.Transform(nl.origin_loc, nl.global_loc.tree()) == nl.global_loc);
+            REQUIRE(ct.InverseTransform(nl.global_loc, loc.tree()) == nl.origin_loc);
+            ct.ncell = 8;
+            for (const auto &ijk : cells)
+              REQUIRE(ct.InverseTransform(ct.Transform(ijk)) == ijk);
+
+            const auto back = forest.FindNeighbors(nl.global_loc);
+            REQUIRE(std::count_if(back.begin(), back.end(), [&loc](const auto &b) {
+                      return b.global_loc == loc;
+                    }) == 1);
+          }
+        }
+      }
+    }
+  }
+}
@@ -323,6 +323,7 @@ TEST_CASE("Logical Location", "[Logical Location]") {
           const auto [t, u, v, k, j, i] = idxer(idx);
           REQUIRE(idxer.IsActive(k, j, i));
         }
+        REQUIRE(idxer.AllActive());
       }
 
       THEN("We can build the correct index range for setting the buffer") {
@@ -336,6 +337,7 @@ TEST_CASE("Logical Location", "[Logical Location]") {
           if (idxer.IsActive(k, j, i)) REQUIRE(j != N);
           if (!idxer.IsActive(k, j, i)) REQUIRE(j == N);
         }
+        REQUIRE(!idxer.AllActive());
       }
 
       THEN("We can build the correct index range for setting the buffer") {
@@ -155,6 +155,16 @@ TEST_CASE("A Metadata struct is created", "[Metadata]") {
     REQUIRE(Metadata({Metadata::Cell, Metadata::Derived}) !=
             Metadata({Metadata::Cell, Metadata::Derived, Metadata::OneCopy}));
   }
+
+  GIVEN("Two Metadata Structs That Only Differ In Ghost Depth") {
+    Metadata a({Metadata::Cell, Metadata::FillGhost}),
+        b({Metadata::Cell, Metadata::FillGhost});
+    REQUIRE(a.GetGhostDepth() == 0);
+    b.SetGhostDepth(2);
+    REQUIRE(b.GetGhostDepth() == 2);
+    REQUIRE(a != b);
+    REQUIRE_THROWS(b.SetGhostDepth(-1));
+  }
 }
 
 TEST_CASE("Metadata FlagCollection", "[Metadata]") {
@@ -240,3 +250,25 @@ TEST_CASE("Refinement Information in Metadata", "[Metadata]") {
     }
   }
 }
+
+TEST_CASE("Metadata of variables with their components innermost", "[Metadata]") {
+  GIVEN("A cell variable with its components innermost") {
+    Metadata m({Metadata::Cell, Metadata::FillGhost, Metadata::ComponentInnermost},
+               std::vector<int>{4});
+    THEN("It's valid and its default refinement ops accept strided arrays") {
+      REQUIRE(m.IsValid());
+      REQUIRE(m.GetRefinementFunctions().component_innermost);
+    }
+    WHEN("We register refinement ops that are not templated on the array type") {
+      THEN("An error is thrown") {
+        REQUIRE_THROWS(m.RegisterRefinementOps<MyProlongOp, MyRestrictOp>());
+      }
+    }
+  }
+  GIVEN("Variables that cannot store their components innermost") {
+    using FlagVec = std::vector<parthenon::MetadataFlag>;
+    REQUIRE_THROWS(Metadata(FlagVec{Metadata::Face, Metadata::ComponentInnermost}));
+    REQUIRE_THROWS(Metadata(
+        FlagVec{Metadata::Cell, Metadata::WithFluxes, Metadata::ComponentInnermost}));
+  }
+}
@@ -0,0 +1,128 @@
+//========================================================================================
+// Parthenon performance portable AMR framework
+// Copyright(C) 2024 The Parthenon collaboration
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "utils/object_pool.hpp"
+
+using parthenon::ObjectPool;
+using parthenon::UsingSameResource;
+
+namespace {
+using view_t = Kokkos::View<int *, Kokkos::HostSpace>;
+using pool_t = ObjectPool<view_t>;
+
+pool_t MakePool(int nobjects) {
+  return pool_t([nobjects](pool_t *pool) {
+    view_t chunk("pool chunk", 2 * nobjects);
+    for (int i = 1; i < nobjects; ++i) {
+      view_t obj(chunk, std::make_pair(2 * i, 2 * i + 2));
+      obj(0) = -1;
+      pool->AddFreeObjectToPool(obj);
+    }
+    view_t obj(chunk, std::make_pair(0, 2));
+    obj(0) = -1;
+    return obj;
+  });
+}
+} // namespace
+
+TEST_CASE("Object pool reference counting", "[ObjectPool]") {
+  GIVEN("A pool of host views") {
+    auto pool = MakePool(8);
+    WHEN("An object is acquired and all of its owners are destroyed") {
+      pool_t::weak_t weak;
+      {
+        pool_t::owner_t owner(pool.Get());
+        pool_t::owner_t copy = owner;
+        weak = owner;
+        REQUIRE(weak.IsValid());
+      }
+      THEN("It is returned to the pool and its key is no longer valid") {
+        REQUIRE(!weak.IsValid());
+        pool_t::owner_t next(pool.Get());
+        REQUIRE(next.IsValid());
+        REQUIRE(!UsingSameResource(weak, next));
+        // The object returned last is handed out again
+        REQUIRE(next.data() == weak.data());
+      }
+    }
+    THEN("The pool reports the memory of all of its objects") {
+      pool_t::owner_t owner(pool.Get());
+      REQUIRE(pool.SizeInBytes() == 8 * 2 * sizeof(int));
+    }
+  }
+}
+
+TEST_CASE("Concurrent acquisition and release of pool objects", "[ObjectPool]") {
+  GIVEN("A pool shared by several threads") {
+    constexpr int nthreads = 8;
+    constexpr int niterations = 2000;
+    constexpr int nobjects = 64;
+    auto pool = MakePool(nobjects);
+    // Allocate the objects up front, so the threads only move them between free lists
+    { pool_t::owner_t warmup(pool.Get()); }
+
+    WHEN("Each thread repeatedly acquires, copies, and releases objects") {
+      std::atomic<int> nfailures{0};
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nthreads; ++t) {
+        threads.emplace_back([&pool, &nfailures, t]() {
+          for (int it = 0; it < niterations; ++it) {
+            pool_t::owner_t a(pool.Get());
+            pool_t::owner_t b(pool.Get());
+            // No other thread may be using the objects at the same time
+            if (a(0) != -1 || b(0) != -1 || a.data() == b.data()) ++nfailures;
+            a(0) = t;
+            b(0) = t;
+            {
+              pool_t::owner_t a_copy = a;
+              pool_t::owner_t b_copy;
+              b_copy = b;
+              std::this_thread::yield();
+              if (a_copy(0) != t || b_copy(0) != t) ++nfailures;
+            }
+            a(0) = -1;
+            b(0) = -1;
+          }
+        });
+      }
+      for (auto &thread : threads)
+        thread.join();
+
+      THEN("No object was handed out twice at the same time") {
+        REQUIRE(nfailures.load() == 0);
+      }
+      THEN("Every object was returned and can be reused") {
+        // Each thread holds at most two objects, so the pool never had to grow
+        REQUIRE(pool.SizeInBytes() == nobjects * 2 * sizeof(int));
+        std::vector<pool_t::owner_t> owners;
+        for (int i = 0; i < 2 * nthreads; ++i) {
+          owners.emplace_back(pool.Get());
+          REQUIRE(owners.back()(0) == -1);
+        }
+      }
+    }
+  }
+}
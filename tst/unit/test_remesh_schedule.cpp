@@ -0,0 +1,81 @@
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+
+#include <catch2/catch.hpp>
+
+#include "mesh/remesh_schedule.hpp"
+
+using parthenon::RemeshSchedule;
+
+TEST_CASE("Remeshes are deferred until they are worth their cost", "[RemeshSchedule]") {
+  GIVEN("A disabled schedule") {
+    RemeshSchedule schedule(0.0, 100);
+    schedule.SetCosts(1.0, 1.0);
+    THEN("Nothing is deferred") {
+      REQUIRE(!schedule.Enabled());
+      REQUIRE(!schedule.DeferDerefinement());
+      REQUIRE(schedule.RebalanceIsWorthwhile(2.0));
+      REQUIRE(schedule.CyclesUntilRebalanceIsWorthwhile(2.0) == 0);
+    }
+  }
+
+  GIVEN("A schedule where a remesh costs as much as four cycles") {
+    constexpr int max_defer = 20;
+    RemeshSchedule schedule(0.25, max_defer);
+    schedule.SetCosts(4.0, 1.0);
+    REQUIRE(schedule.Enabled());
+
+    THEN("Derefinement waits until a quarter of the computing time covers a remesh") {
+      for (int n = 0; n < 16; ++n) {
+        REQUIRE(schedule.CyclesSinceRemesh() == n);
+        REQUIRE(schedule.DeferDerefinement());
+        schedule.AddCycle(1.0);
+      }
+      REQUIRE(!schedule.DeferDerefinement());
+    }
+
+    THEN("A rebalance waits until the imbalance has cost as much as a remesh") {
+      // Half of the time of the slowest rank is lost with an imbalance of two
+      for (int n = 0; n < 8; ++n) {
+        REQUIRE(!schedule.RebalanceIsWorthwhile(2.0));
+        REQUIRE(schedule.CyclesUntilRebalanceIsWorthwhile(2.0) == 8 - n);
+        schedule.AddCycle(1.0);
+      }
+      REQUIRE(schedule.RebalanceIsWorthwhile(2.0));
+      REQUIRE(schedule.CyclesUntilRebalanceIsWorthwhile(2.0) == 0);
+    }
+
+    THEN("A rebalance is not deferred for more than the maximum number of cycles") {
+      for (int n = 0; n < max_defer; ++n) {
+        REQUIRE(!schedule.RebalanceIsWorthwhile(1.0));
+        REQUIRE(schedule.CyclesUntilRebalanceIsWorthwhile(1.0) == max_defer - n);
+        schedule.AddCycle(1.0);
+      }
+      REQUIRE(schedule.RebalanceIsWorthwhile(1.0));
+    }
+
+    WHEN("A remesh is recorded") {
+      for (int n = 0; n < 3; ++n) {
+        schedule.AddCycle(2.0);
+      }
+      REQUIRE(schedule.LocalComputeTimePerCycle() == 2.0);
+      schedule.SetCosts(1.0, schedule.LocalComputeTimePerCycle());
+      THEN("The cycles are counted from the remesh with the new costs") {
+        REQUIRE(schedule.CyclesSinceRemesh() == 0);
+        REQUIRE(schedule.CyclesUntilRebalanceIsWorthwhile(2.0) == 1);
+        schedule.AddCycle(2.0);
+        REQUIRE(schedule.RebalanceIsWorthwhile(2.0));
+      }
+    }
+  }
+}
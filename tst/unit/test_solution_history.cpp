@@ -0,0 +1,197 @@
+//========================================================================================
+// Parthenon performance portable AMR framework
+// Copyright(C) 2024 The Parthenon collaboration
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include "basic_types.hpp"
+#include "interface/make_pack_descriptor.hpp"
+#include "interface/mesh_data.hpp"
+#include "interface/meshblock_data.hpp"
+#include "interface/metadata.hpp"
+#include "interface/sparse_pack.hpp"
+#include "interface/state_descriptor.hpp"
+#include "kokkos_abstraction.hpp"
+#include "mesh/mesh.hpp"
+#include "mesh/meshblock.hpp"
+#include "parameter_input.hpp"
+#include "solvers/solution_history.hpp"
+#include "tasks/tasks.hpp"
+
+// TODO(jcd): can't call the MeshBlock constructor without mesh_refinement.hpp???
+#include "mesh/mesh_refinement.hpp"
+
+using parthenon::ApplicationInput;
+using parthenon::BlockList_t;
+using parthenon::DevExecSpace;
+using parthenon::IndexDomain;
+using parthenon::loop_pattern_mdrange_tag;
+using parthenon::Mesh;
+using parthenon::MeshBlock;
+using parthenon::MeshData;
+using parthenon::Metadata;
+using parthenon::Packages_t;
+using parthenon::ParameterInput;
+using parthenon::Real;
+using parthenon::StateDescriptor;
+using parthenon::TaskCollection;
+using parthenon::TaskID;
+
+namespace {
+struct u : public parthenon::variable_names::base_t<false> {
+  template <class... Ts>
+  KOKKOS_INLINE_FUNCTION u(Ts &&...args)
+      : parthenon::variable_names::base_t<false>(std::forward<Ts>(args)...) {}
+  static std::string name() { return "u"; }
+};
+using history_t = parthenon::solvers::SolutionHistory<u>;
+
+// Solution of the s-th solve, quadratic in s at every cell
+KOKKOS_INLINE_FUNCTION Real Solution(int s, int b, int k, int j, int i) {
+  return (b + 1.0) + (i - j) * s + 0.5 * (k + j + 1.0) * s * s;
+}
+
+// Guess for the s-th solve extrapolated from the n previous solutions
+KOKKOS_INLINE_FUNCTION Real Guess(int n, int s, int b, int k, int j, int i) {
+  if (n == 1) return Solution(s - 1, b, k, j, i);
+  if (n == 2) return 2.0 * Solution(s - 1, b, k, j, i) - Solution(s - 2, b, k, j, i);
+  return 3.0 * Solution(s - 1, b, k, j, i) - 3.0 * Solution(s - 2, b, k, j, i) +
+         Solution(s - 3, b, k, j, i);
+}
+} // namespace
+
+TEST_CASE("Initial guesses from previous solutions", "[SolutionHistory]") {
+  constexpr int N = 4;
+  constexpr int NDIM = 3;
+  constexpr int NBLOCKS = 3;
+
+  GIVEN("A history of three solutions on a few blocks") {
+    std::stringstream is;
+    is << "<parthenon/mesh>" << std::endl;
+    for (const auto x : {"x1", "x2", "x3"}) {
+      is << "n" << x << " = " << N << std::endl;
+      is << x << "min = 0.0" << std::endl;
+      is << x << "max = 1.0" << std::endl;
+      is << "i" << x << "_bc = outflow" << std::endl;
+      is << "o" << x << "_bc = outflow" << std::endl;
+    }
+    auto pin = std::make_shared<ParameterInput>();
+    pin->LoadFromStream(is);
+    auto app_in = std::make_shared<ApplicationInput>();
+
+    auto pkg = std::make_shared<StateDescriptor>("Test package");
+    pkg->AddField<u>(Metadata({Metadata::Cell, Metadata::Independent}));
+    history_t history(pkg.get(), history_t::max_solutions, {});
+    Packages_t packages;
+    packages.Add(pkg);
+    // Only sets up the packages and the tree, the blocks are built by hand below
+    auto mesh = std::make_shared<Mesh>(pin.get(), app_in.get(), packages, 1);
+
+    BlockList_t block_list;
+    for (int b = 0; b < NBLOCKS; ++b) {
+      auto pmb = std::make_shared<MeshBlock>(N, NDIM);
+      pmb->pmy_mesh = mesh.get();
+      pmb->meshblock_data.Get()->Initialize(mesh->resolved_packages, pmb);
+      block_list.push_back(pmb);
+    }
+    auto md = std::make_shared<MeshData<Real>>("base");
+    md->Initialize(block_list, mesh.get());
+
+    auto ib = block_list[0]->cellbounds.GetBoundsI(IndexDomain::entire);
+    auto jb = block_list[0]->cellbounds.GetBoundsJ(IndexDomain::entire);
+    auto kb = block_list[0]->cellbounds.GetBoundsK(IndexDomain::entire);
+    auto desc = parthenon::MakePackDescriptor<u, history_t::prev0, history_t::prev1,
+                                              history_t::prev2>(md.get());
+    auto pack = desc.GetPack(md.get());
+
+    // Stores the s-th solution through the tasks used by the solvers
+    auto store = [&](int s) {
+      parthenon::par_for(
+          loop_pattern_mdrange_tag, "set solution", DevExecSpace(), 0,
+          pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+          KOKKOS_LAMBDA(int b, int k, int j, int i) {
+            pack(b, u(), k, j, i) = Solution(s, b, k, j, i);
+          });
+      TaskCollection tc;
+      auto &tr = tc.AddRegion(1);
+      history.AddStoreTasks<u>(tr[0], TaskID(0), md);
+      tc.Execute();
+    };
+    // Number of cells where u differs from the guess for the s-th solve built from n
+    // previous solutions, or from the s-th solution itself for n = 0
+    auto nwrong = [&](int n, int s) {
+      int nw = 0;
+      parthenon::par_reduce(
+          loop_pattern_mdrange_tag, "check guess", DevExecSpace(), 0,
+          pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+          KOKKOS_LAMBDA(int b, int k, int j, int i, int &ltot) {
+            const Real expected =
+                (n > 0) ? Guess(n, s, b, k, j, i) : Solution(s, b, k, j, i);
+            if (std::abs(pack(b, u(), k, j, i) - expected) >
+                1.e-12 * (1.0 + std::abs(expected)))
+              ltot += 1;
+          },
+          nw);
+      return nw;
+    };
+
+    THEN("The history is sent along with blocks that are moved to another rank") {
+      for (const auto &name : history.GetInternalVariableNames()) {
+        REQUIRE(pkg->FieldMetadata(name).IsSet(Metadata::ForceRemeshComm));
+      }
+    }
+
+    WHEN("Three solutions have been stored") {
+      for (int s = 0; s < 3; ++s) {
+        REQUIRE(history.NumAvailable(mesh.get()) == s);
+        store(s);
+      }
+      REQUIRE(history.NumAvailable(mesh.get()) == 3);
+
+      THEN("The extrapolated guess reproduces the next quadratic solution") {
+        history.Extrapolate<u>(md, 3);
+        REQUIRE(nwrong(0, 3) == 0);
+      }
+      THEN("Extrapolating from fewer solutions only uses the most recent ones") {
+        history.Extrapolate<u>(md, 1);
+        REQUIRE(nwrong(1, 3) == 0);
+        history.Extrapolate<u>(md, 2);
+        REQUIRE(nwrong(2, 3) == 0);
+      }
+      THEN("A load balance that keeps all blocks keeps the history") {
+        // Moving blocks between ranks neither refines nor derefines any of them
+        REQUIRE(history.NumAvailable(mesh.get()) == 3);
+      }
+      THEN("Refining or derefining blocks discards the history") {
+        mesh->nbnew = 8;
+        mesh->nbdel = 1;
+        REQUIRE(history.NumAvailable(mesh.get()) == 0);
+        AND_THEN("The history is rebuilt from the following solutions") {
+          store(3);
+          REQUIRE(history.NumAvailable(mesh.get()) == 1);
+          history.Extrapolate<u>(md, 1);
+          REQUIRE(nwrong(0, 3) == 0);
+        }
+      }
+    }
+  }
+}
@@ -23,6 +23,7 @@
 #include "interface/meshblock_data.hpp"
 #include "interface/metadata.hpp"
 #include "interface/sparse_pack.hpp"
+#include "interface/update.hpp"
 #include "kokkos_abstraction.hpp"
 #include "mesh/meshblock.hpp"
 
@@ -85,6 +86,13 @@ struct v7 : public parthenon::variable_names::base_t<false, ANYDIM, 3> {
   static std::string name() { return "v7"; }
 };
 
+struct v9 : public parthenon::variable_names::base_t<false, 3, 3> {
+  template <class... Ts>
+  KOKKOS_INLINE_FUNCTION v9(Ts &&...args)
+      : parthenon::variable_names::base_t<false, 3, 3>(std::forward<Ts>(args)...) {}
+  static std::string name() { return "v9"; }
+};
+
 } // namespace
 
 TEST_CASE("Test behavior of sparse packs", "[SparsePack]") {
@@ -154,6 +162,99 @@ TEST_CASE("Test behavior of sparse packs", "[SparsePack]") {
     }
   }
 
+  GIVEN("A tensor variable that stores its components innermost") {
+    Metadata m_ci({Metadata::Cell, Metadata::Independent, Metadata::ComponentInnermost},
+                  std::vector<int>{3, 3});
+    auto pkg = std::make_shared<StateDescriptor>("Test package");
+    pkg->AddField<v9>(m_ci);
+    BlockList_t block_list = MakeBlockList(pkg, NBLOCKS, N, NDIM);
+
+    MeshData<Real> mesh_data("base");
+    mesh_data.Initialize(block_list, nullptr);
+
+    WHEN("We initialize the variable through its logical view") {
+      auto ib = block_list[0]->cellbounds.GetBoundsI(IndexDomain::entire);
+      auto jb = block_list[0]->cellbounds.GetBoundsJ(IndexDomain::entire);
+      auto kb = block_list[0]->cellbounds.GetBoundsK(IndexDomain::entire);
+      for (int b = 0; b < NBLOCKS; ++b) {
+        auto &pmbd = block_list[b]->meshblock_data.Get();
+        auto &var = pmbd->Get("v9");
+        auto q = var.GetLogicalView(var.data);
+        par_for(
+            loop_pattern_mdrange_tag, "initializev9", DevExecSpace(), kb.s, kb.e, jb.s,
+            jb.e, ib.s, ib.e, KOKKOS_LAMBDA(int k, int j, int i) {
+              for (int l = 0; l < 3; ++l) {
+                for (int m = 0; m < 3; ++m) {
+                  q(0, 0, l, m, k, j, i) = m + 1e1 * l + 1e2 * i + 1e4 * b;
+                }
+              }
+            });
+      }
+      THEN("The components of each cell are contiguous in data") {
+        auto &var = block_list[0]->meshblock_data.Get()->Get("v9");
+        REQUIRE(var.data.GetDim(1) == 9 * (ib.e + 1));
+        for (int l = 0; l < 3; ++l) {
+          for (int m = 0; m < 3; ++m) {
+            // Every component spans exactly the allocation of the variable
+            auto comp = var.GetComponent(0, l, m);
+            REQUIRE(comp.data() == var.data.data());
+            REQUIRE(comp.size() == var.data.size());
+            REQUIRE(comp.i_stride == 9);
+            REQUIRE(comp.i_offset == 3 * l + m);
+            REQUIRE(comp.StorageI(ib.e) == 9 * ib.e + 3 * l + m);
+          }
+        }
+      }
+      THEN("A sparse pack indexed by cell finds the components") {
+        using TE = parthenon::TopologicalElement;
+        auto desc = parthenon::MakePackDescriptor<v9>(pkg.get());
+        auto sparse_pack = desc.GetPack(&mesh_data);
+        REQUIRE(!sparse_pack.ContiguousCellsHost());
+        int nwrong = 0;
+        par_reduce(
+            loop_pattern_mdrange_tag, "check component innermost", DevExecSpace(), 0,
+            sparse_pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+            KOKKOS_LAMBDA(int b, int k, int j, int i, int &ltot) {
+              for (int l = 0; l < 3; ++l) {
+                for (int m = 0; m < 3; ++m) {
+                  const Real n = m + 1e1 * l + 1e2 * i + 1e4 * b;
+                  if (sparse_pack(b, v9(l, m), k, j, i) != n) ltot += 1;
+                  if (sparse_pack(b, TE::CC, v9(l, m), k, j, i) != n) ltot += 1;
+                  // All components of the cell follow each other in memory
+                  if (&sparse_pack(b, v9(l, m), k, j, i) !=
+                      &sparse_pack(b, v9(0, 0), k, j, i) + 3 * l + m)
+                    ltot += 1;
+                }
+              }
+            },
+            nwrong);
+        REQUIRE(nwrong == 0);
+      }
+      THEN("Kernels written for the default layout work on the variable") {
+        parthenon::Update::SetDataToConstant(
+            std::vector<parthenon::MetadataFlag>{Metadata::ComponentInnermost},
+            &mesh_data, 7.0);
+        int nwrong = 0;
+        for (int b = 0; b < NBLOCKS; ++b) {
+          auto &var = block_list[b]->meshblock_data.Get()->Get("v9");
+          auto q = var.GetLogicalView(var.data);
+          par_reduce(
+              loop_pattern_mdrange_tag, "check constant", DevExecSpace(), kb.s, kb.e,
+              jb.s, jb.e, ib.s, ib.e,
+              KOKKOS_LAMBDA(int k, int j, int i, int &ltot) {
+                for (int l = 0; l < 3; ++l) {
+                  for (int m = 0; m < 3; ++m) {
+                    if (q(0, 0, l, m, k, j, i) != 7.0) ltot += 1;
+                  }
+                }
+              },
+              nwrong);
+        }
+        REQUIRE(nwrong == 0);
+      }
+    }
+  }
+
   GIVEN("A set of meshblocks and meshblock and mesh data") {
     const std::vector<int> scalar_shape{N, N, N};
     const std::vector<int> vector_shape{N, N, N, 3};
@@ -222,6 +323,60 @@ TEST_CASE("Test behavior of sparse packs", "[SparsePack]") {
         REQUIRE(pack.GetSizeHost(1, v3()) == 3);
       }
 
+      THEN("A legacy pack on a block with all variables allocated is a window into the "
+           "sparse pack over the same variables") {
+        auto &pmbd = block_list[1]->meshblock_data.Get();
+        PackIndexMap imap;
+        const auto &legacy =
+            pmbd->PackVariablesAndFluxes(std::vector<std::string>{"v1", "v3"}, imap);
+        auto desc = parthenon::MakePackDescriptor<v1, v3>(
+            pkg.get(), {}, {parthenon::PDOpt::WithFluxes});
+        auto sparse_pack = desc.GetPack(pmbd.get());
+        REQUIRE(imap["v3"].first == 1);
+        REQUIRE(imap["v3"].second == 3);
+
+        int nwrong = 0;
+        par_reduce(
+            parthenon::loop_pattern_flatrange_tag, "check legacy", DevExecSpace(), 0, 3,
+            KOKKOS_LAMBDA(const int n, int &ltot) {
+              if (&legacy(n) != &sparse_pack(0, n)) ltot += 1;
+              if (&legacy.flux(1)(n) != &sparse_pack.flux(0, 1, n)) ltot += 1;
+              if (legacy(n, kb.s, jb.s, ib.s) != sparse_pack(0, n, kb.s, jb.s, ib.s))
+                ltot += 1;
+            },
+            nwrong);
+        REQUIRE(nwrong == 0);
+      }
+
+      THEN("A legacy pack stays valid after the sparse pack cache is cleared") {
+        auto &pmbd = block_list[1]->meshblock_data.Get();
+        PackIndexMap imap;
+        auto legacy = pmbd->PackVariables(std::vector<std::string>{"v1", "v3"}, imap);
+        // Drop every other reference to the storage the windows point into
+        pmbd->GetSparsePackCache().clear();
+
+        int nwrong = 0;
+        par_reduce(
+            loop_pattern_mdrange_tag, "check legacy after clear", DevExecSpace(), 0, 3,
+            kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+            KOKKOS_LAMBDA(int n, int k, int j, int i, int &ltot) {
+              const int v = (n == 0) ? 0 : 1;
+              const int c = (n == 0) ? 0 : n - 1;
+              Real expected = i + 1e1 * j + 1e2 * k + 1e4 * c + 1e5 * v + 1e3 * 1;
+              if (legacy(n, k, j, i) != expected) ltot += 1;
+            },
+            nwrong);
+        REQUIRE(nwrong == 0);
+
+        AND_THEN("A new legacy pack over the same variables has the same layout") {
+          PackIndexMap imap2;
+          auto again = pmbd->PackVariables(std::vector<std::string>{"v1", "v3"}, imap2);
+          REQUIRE(imap2["v3"].first == imap["v3"].first);
+          REQUIRE(imap2["v3"].second == imap["v3"].second);
+          REQUIRE(again.GetDim(4) == legacy.GetDim(4));
+        }
+      }
+
       THEN("A sparse pack correctly loads this data and can be read from v3 on all "
            "blocks") {
         // Create a pack use type variables
@@ -387,6 +542,30 @@ TEST_CASE("Test behavior of sparse packs", "[SparsePack]") {
         auto sparse_pack = desc.GetPack(&mesh_data, include_blocks);
         REQUIRE(sparse_pack.GetNBlocks() == NBLOCKS / 2 + 1);
       }
+
+      THEN("The active work list of a sparse pack only contains the allocated "
+           "variables and can be looped over") {
+        auto desc = parthenon::MakePackDescriptor<v3>(pkg.get());
+        auto sparse_pack = desc.GetPack(&mesh_data);
+        // v3 has three components and is deallocated on block 2
+        REQUIRE(sparse_pack.GetNumActive() == 3 * (NBLOCKS - 1));
+        for (int a = 0; a < sparse_pack.GetNumActive(); ++a)
+          REQUIRE(sparse_pack.GetActiveBlockHost(a) != 2);
+
+        parthenon::ParArray1D<int> ncells("ncells", NBLOCKS);
+        parthenon::par_for_active(
+            "count active cells", DevExecSpace(), sparse_pack, kb, jb, ib,
+            KOKKOS_LAMBDA(const int b, const int n, const int k, const int j,
+                          const int i) {
+              Real val = i + 1e1 * j + 1e2 * k + 1e4 * n + 1e5 + 1e3 * b;
+              if (sparse_pack(b, n, k, j, i) == val) Kokkos::atomic_add(&ncells(b), 1);
+            });
+        auto ncells_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ncells);
+        const int ncells_block =
+            (ib.e - ib.s + 1) * (jb.e - jb.s + 1) * (kb.e - kb.s + 1);
+        for (int b = 0; b < NBLOCKS; ++b)
+          REQUIRE(ncells_h(b) == ((b == 2) ? 0 : 3 * ncells_block));
+      }
     }
   }
 }
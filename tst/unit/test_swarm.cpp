@@ -27,6 +27,7 @@
 #include "bvals/boundary_conditions.hpp"
 #include "bvals/boundary_conditions_generic.hpp"
 #include "bvals/neighbor_block.hpp"
+#include "interface/mesh_data.hpp"
 #include "interface/swarm.hpp"
 #include "interface/swarm_default_names.hpp"
 #include "kokkos_abstraction.hpp"
@@ -38,8 +39,10 @@
 using Real = double;
 using parthenon::ApplicationInput;
 using parthenon::BoundaryFlag;
+using parthenon::BlockList_t;
 using parthenon::Mesh;
 using parthenon::MeshBlock;
+using parthenon::MeshData;
 using parthenon::Metadata;
 using parthenon::Packages_t;
 using parthenon::ParameterInput;
@@ -238,3 +241,118 @@ TEST_CASE("Swarm memory management", "[Swarm]") {
   failures_h = failures_d.GetHostMirrorAndCopy();
   REQUIRE(failures_h(0) == 0);
 }
+
+TEST_CASE("Swarm boundary conditions on MeshData", "[Swarm]") {
+  std::stringstream is;
+  is << "<parthenon/mesh>" << endl;
+  is << "x1min = -0.5" << endl;
+  is << "x2min = -0.5" << endl;
+  is << "x3min = -0.5" << endl;
+  is << "x1max = 0.5" << endl;
+  is << "x2max = 0.5" << endl;
+  is << "x3max = 0.5" << endl;
+  is << "nx1 = 4" << endl;
+  is << "nx2 = 4" << endl;
+  is << "nx3 = 4" << endl;
+  is << "ix1_bc = periodic" << endl;
+  is << "ox1_bc = periodic" << endl;
+  is << "ix2_bc = outflow" << endl;
+  is << "ox2_bc = outflow" << endl;
+  is << "ix3_bc = outflow" << endl;
+  is << "ox3_bc = outflow" << endl;
+  is << "pack_size = 1" << endl;
+  auto pin = std::make_shared<ParameterInput>();
+  pin->LoadFromStream(is);
+  auto app_in = std::make_shared<ApplicationInput>();
+  Packages_t packages;
+  auto pkg = std::make_shared<parthenon::StateDescriptor>("test");
+  packages.Add(pkg);
+  auto mesh = std::make_shared<Mesh>(pin.get(), app_in.get(), packages, 1);
+
+  // Particles inside the domain, across the periodic x1 faces, and across the outflow
+  // x2 and x3 faces
+  constexpr int NPARTICLES = 8;
+  const Real x0[NPARTICLES] = {0.0, -0.6, 0.7, 0.0, 0.0, 0.8, 0.1, -0.55};
+  const Real y0[NPARTICLES] = {0.0, 0.0, 0.0, -0.6, 0.0, 0.7, 0.2, 0.4};
+  const Real z0[NPARTICLES] = {0.0, 0.0, 0.0, 0.0, 0.6, 0.0, -0.3, 0.45};
+
+  // Two identical sets of blocks, one for each way of applying the conditions
+  constexpr int NBLOCKS = 3;
+  auto make_blocks = [&]() {
+    BlockList_t blocks;
+    for (int b = 0; b < NBLOCKS; ++b) {
+      auto pmb = std::make_shared<MeshBlock>(4, 3);
+      pmb->gid = b;
+      pmb->loc = mesh->GetLocList()[0];
+      pmb->pmy_mesh = mesh.get();
+      for (int i = 0; i < 6; i++) {
+        pmb->boundary_flag[i] = mesh->mesh_bcs[i];
+      }
+      auto &pmbd = pmb->meshblock_data.Get();
+      pmbd->Initialize(pkg, pmb);
+      auto swarm = std::make_shared<Swarm>("test swarm", Metadata(), NUMINIT);
+      swarm->SetBlockPointer(pmb);
+      pmbd->GetSwarmData()->Add(swarm);
+
+      swarm->AddEmptyParticles(NPARTICLES);
+      auto x_h = swarm->Get<Real>(swarm_position::x::name()).Get().GetHostMirror();
+      auto y_h = swarm->Get<Real>(swarm_position::y::name()).Get().GetHostMirror();
+      auto z_h = swarm->Get<Real>(swarm_position::z::name()).Get().GetHostMirror();
+      for (int n = 0; n < NPARTICLES; n++) {
+        // Shift the particles a little on each block, but not across any face
+        x_h(n) = x0[n] + 0.01 * b;
+        y_h(n) = y0[n] - 0.01 * b;
+        z_h(n) = z0[n] + 0.01 * b;
+      }
+      swarm->Get<Real>(swarm_position::x::name()).Get().DeepCopy(x_h);
+      swarm->Get<Real>(swarm_position::y::name()).Get().DeepCopy(y_h);
+      swarm->Get<Real>(swarm_position::z::name()).Get().DeepCopy(z_h);
+      blocks.push_back(pmb);
+    }
+    return blocks;
+  };
+  BlockList_t blocks = make_blocks();
+  BlockList_t blocks_md = make_blocks();
+
+  for (auto &pmb : blocks) {
+    auto swarm = pmb->meshblock_data.Get()->GetSwarmData()->Get("test swarm");
+    ApplySwarmBoundaryConditions(swarm);
+    swarm->RemoveMarkedParticles();
+  }
+
+  auto md = std::make_shared<MeshData<Real>>("base");
+  md->Initialize(blocks_md, mesh.get());
+  ApplySwarmBoundaryConditionsMD(md);
+  for (int b = 0; b < NBLOCKS; ++b) {
+    md->GetSwarmData(b)->Get("test swarm")->RemoveMarkedParticles();
+  }
+
+  for (int b = 0; b < NBLOCKS; ++b) {
+    auto swarm = blocks[b]->meshblock_data.Get()->GetSwarmData()->Get("test swarm");
+    auto swarm_md = md->GetSwarmData(b)->Get("test swarm");
+    // Three of the particles leave through the outflow faces
+    REQUIRE(swarm->GetNumActive() == NPARTICLES - 3);
+    REQUIRE(swarm_md->GetNumActive() == swarm->GetNumActive());
+
+    auto mask_h = Kokkos::create_mirror_view_and_copy(parthenon::HostMemSpace(),
+                                                      swarm->GetMask());
+    auto mask_md_h = Kokkos::create_mirror_view_and_copy(parthenon::HostMemSpace(),
+                                                         swarm_md->GetMask());
+    for (auto name : {swarm_position::x::name(), swarm_position::y::name(),
+                      swarm_position::z::name()}) {
+      auto pos_h = swarm->Get<Real>(name).Get().GetHostMirrorAndCopy();
+      auto pos_md_h = swarm_md->Get<Real>(name).Get().GetHostMirrorAndCopy();
+      for (int n = 0; n < NPARTICLES; n++) {
+        REQUIRE(mask_md_h(n) == mask_h(n));
+        if (mask_h(n)) {
+          REQUIRE(pos_md_h(n) == pos_h(n));
+        }
+      }
+    }
+    // Particles that crossed a periodic face are moved back into the domain
+    auto x_h =
+        swarm_md->Get<Real>(swarm_position::x::name()).Get().GetHostMirrorAndCopy();
+    REQUIRE(x_h(1) == Approx(0.4 + 0.01 * b));
+    REQUIRE(x_h(2) == Approx(-0.3 + 0.01 * b));
+  }
+}
@@ -0,0 +1,85 @@
+//========================================================================================
+// (C) (or copyright) 2024. Triad National Security, LLC. All rights reserved.
+//
+// This program was produced under U.S. Government contract 89233218CNA000001 for Los
+// Alamos National Laboratory (LANL), which is operated by Triad National Security, LLC
+// for the U.S. Department of Energy/National Nuclear Security Administration. All rights
+// in the program are reserved by Triad National Security, LLC, and the U.S. Department
+// of Energy/National Nuclear Security Administration. The Government is granted for
+// itself and others acting on its behalf a nonexclusive, paid-up, irrevocable worldwide
+// license in this material to reproduce, prepare derivative works, distribute copies to
+// the public, perform publicly and display publicly, and to permit others to do so.
+//========================================================================================
+
+#include <cmath>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include "basic_types.hpp"
+#include "interface/mesh_data.hpp"
+#include "interface/state_descriptor.hpp"
+#include "kokkos_abstraction.hpp"
+#include "solvers/solver_utils.hpp"
+#include "tasks/tasks.hpp"
+
+using parthenon::DevExecSpace;
+using parthenon::loop_pattern_flatrange_tag;
+using parthenon::ParArray2D;
+using parthenon::Real;
+
+namespace {
+// Coefficients of a diagonally dominant system and its solution, varying along the
+// system and between systems
+KOKKOS_INLINE_FUNCTION Real Lower(int s, int n) { return -1.0 - 0.1 * ((s + n) % 3); }
+KOKKOS_INLINE_FUNCTION Real Upper(int s, int n) { return -0.5 - 0.2 * ((s * n) % 4); }
+KOKKOS_INLINE_FUNCTION Real Diag(int s, int n) { return 4.0 + 0.1 * s + 0.01 * n; }
+KOKKOS_INLINE_FUNCTION Real Solution(int s, int n) {
+  return std::sin(0.3 * n + s) + 0.1 * n;
+}
+// Row n of A x for the exact solution, with the coefficients outside of [ns, ne] dropped
+KOKKOS_INLINE_FUNCTION Real Rhs(int s, int n, int ns, int ne) {
+  Real r = Diag(s, n) * Solution(s, n);
+  if (n > ns) r += Lower(s, n) * Solution(s, n - 1);
+  if (n < ne) r += Upper(s, n) * Solution(s, n + 1);
+  return r;
+}
+} // namespace
+
+TEST_CASE("Tridiagonal systems are solved by the Thomas algorithm", "[ThomasSolve]") {
+  using parthenon::solvers::utils::ThomasSolve;
+  constexpr int NSYS = 5;
+  constexpr int N = 17;
+
+  GIVEN("Several tridiagonal systems whose solution is known") {
+    // The systems occupy rows ns to ne of the arrays to check the offsets
+    const int ns = 2;
+    for (const int ne : {ns, ns + 1, ns + N - 1}) {
+      ParArray2D<Real> x("x", NSYS, ns + N);
+      ParArray2D<Real> c("c", NSYS, ns + N);
+
+      WHEN("The systems of length " + std::to_string(ne - ns + 1) + " are solved") {
+        int nwrong = 0;
+        parthenon::par_reduce(
+            loop_pattern_flatrange_tag, "ThomasSolve", DevExecSpace(), 0, NSYS - 1,
+            KOKKOS_LAMBDA(const int s, int &lnwrong) {
+              // The right hand side is stored in x, so it is overwritten by the solution
+              for (int n = ns; n <= ne; ++n)
+                x(s, n) = Rhs(s, n, ns, ne);
+              ThomasSolve(
+                  ns, ne, [&](const int n) { return Lower(s, n); },
+                  [&](const int n) { return Diag(s, n); },
+                  [&](const int n) { return Upper(s, n); },
+                  [&](const int n) { return x(s, n); },
+                  [&](const int n) -> Real & { return c(s, n); },
+                  [&](const int n) -> Real & { return x(s, n); });
+              for (int n = ns; n <= ne; ++n) {
+                if (std::abs(x(s, n) - Solution(s, n)) > 1.e-12) lnwrong += 1;
+              }
+            },
+            Kokkos::Sum<int>(nwrong));
+        THEN("The solution is recovered") { REQUIRE(nwrong == 0); }
+      }
+    }
+  }
+}